@@ -17,6 +17,8 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - Traza como política de plantilla (NoTrace/CoutTrace)
+ *    16/10/2026 - Instancia para la traza binaria (BinaryTrace)
 */
 
 /**
@@ -29,10 +31,8 @@
 #include "automata_simulator.h"
 
 #include <queue>
-#include <iostream>
-#include <vector>
-#include <algorithm>
-#include <sstream>
+
+#include "trace_log.h"
 
 namespace p06 {
 
@@ -81,54 +81,48 @@ namespace p06 {
   }
 
   /**
-  * @brief Simula la cadena sobre el autómata.
+  * @brief Simula la cadena sobre el autómata (sin traza).
   *
   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
   * @return true si la cadena es aceptada, false si es rechazada
   */
-  // Modif
-  bool AutomatonSimulator::Simulate(const std::string& input, bool trace) const {
-    // imprimir un conjunto en formato {a,b,c}
-    auto PrintSet = [](const Automaton::StateSet& s) -> std::string {
-      std::vector<Automaton::State> v(s.begin(), s.end());
-      std::sort(v.begin(), v.end());
-      std::ostringstream oss;
-      oss << "{";
-      for (size_t i = 0; i < v.size(); ++i) {
-        if (i) oss << ",";
-        oss << v[i];
-      }
-      oss << "}";
-      return oss.str();
-    }; 
+  bool AutomatonSimulator::Simulate(const std::string& input) const {
+    NoTrace trace;
+    return Simulate(input, trace);
+  }
 
+  /**
+  * @brief Simula la cadena sobre el autómata informando a la política de traza.
+  *
+  * Lo que solo sirve para la traza (búsqueda de & desde los estados actuales
+  * y desde los destinos directos) va bajo if constexpr, de modo que la
+  * instancia de NoTrace no lo contiene.
+  *
+  * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+  * @param trace Política que recibe los eventos
+  * @return true si la cadena es aceptada, false si es rechazada
+  */
+  // Modif
+  template <class TracePolicy>
+  bool AutomatonSimulator::Simulate(const std::string& input, TracePolicy& trace) const {
     // Inicializar conjunto de estados actuales con epsilon-closure del estado inicial
     Automaton::StateSet current;
     current.insert(automaton_.GetStartState());
     current = EpsilonClosure(current);
 
-    if (trace) {
-      std::cout << "Estado inicial: " << PrintSet(current) << "\n";
-    }
+    trace.Start(current);
 
     // Si la entrada contiene símbolos fuera del alfabeto, rechazar
     for (char c : input) {
       if (!automaton_.IsSymbolInAlphabet(c)) {
-        if (trace) {
-          std::cout << "Símbolo no válido encontrado en la entrada: '" << c << "' -> Rejected\n";
-        }
+        trace.InvalidSymbol(c);
         return false;
       }
     }
 
     // Procesar cada símbolo
     for (char c : input) {
-      if (trace) {
-        std::cout << "--------------------------------------------------\n";
-        std::cout << "Símbolo actual: '" << c << "'\n";
-        std::cout << "Estados actuales: " << PrintSet(current) << "\n";
-        std::cout << "Reglas (transiciones desde cada estado con '" << c << "'):\n";
-      }
+      trace.Symbol(c, current);
 
       Automaton::StateSet next;  // conjunto temporal de estados alcanzables con c
 
@@ -138,54 +132,42 @@ namespace p06 {
         // transiciones con el símbolo c
         auto it_sym = trans_map.find(c);
         if (it_sym != trans_map.end()) {
-          // mostramos la regla (s,c) -> {destinos}
-          if (trace) {
-            std::cout << "  (" << s << "," << c << ") -> " << PrintSet(it_sym->second) << "\n";
-          }
+          // regla (s,c) -> {destinos}
+          trace.Rule(s, c, &it_sym->second);
           for (const auto& dest : it_sym->second) {
             next.insert(dest);
           }
         } else {
-          if (trace) {
-            std::cout << "  (" << s << "," << c << ") -> {}" << "\n";
-          }
+          trace.Rule(s, c, nullptr);
         }
-        // También mostramos si desde s hay transiciones epsilon directas (informativo)
-        auto it_eps_from_s = trans_map.find('&');
-        if (trace) {
+        // También informamos si desde s hay transiciones epsilon directas
+        if constexpr (TracePolicy::kEnabled) {
+          auto it_eps_from_s = trans_map.find('&');
           if (it_eps_from_s != trans_map.end()) {
-            std::cout << "  (" << s << ",&) -> " << PrintSet(it_eps_from_s->second) << "  [epsilon desde estado actual]\n";
+            trace.EpsilonFromCurrent(s, it_eps_from_s->second);
           }
         }
       }
 
-      // Mostrar si desde los destinos hay & transiciones
-      if (trace) {
-        std::cout << "Destinos directos tras consumir '" << c << "': " << PrintSet(next) << "\n";
-        std::cout << "Reglas (epsilon desde destinos directos):\n";
-        for (auto destState : next) {
-          const auto& trans_map_dest = automaton_.GetTransitionsForState(destState);
+      // Informar de las & transiciones desde los destinos
+      trace.DirectTargets(c, next);
+      if constexpr (TracePolicy::kEnabled) {
+        for (auto dest_state : next) {
+          const auto& trans_map_dest = automaton_.GetTransitionsForState(dest_state);
           auto it_eps = trans_map_dest.find('&');
-          if (it_eps != trans_map_dest.end()) {
-            std::cout << "  (" << destState << ",&) -> " << PrintSet(it_eps->second) << "\n";
-          } else {
-            std::cout << "  (" << destState << ",&) -> {}" << "\n";
-          }
+          trace.EpsilonFromTarget(dest_state,
+                                  it_eps != trans_map_dest.end() ? &it_eps->second : nullptr);
         }
       }
 
       // Aplicamos epsilon-closure al conjunto next (transiciones epsilon posteriores)
       current = EpsilonClosure(next);
 
-      if (trace) {
-        std::cout << "Estados tras epsilon-clausura: " << PrintSet(current) << "\n";
-      }
+      trace.Closure(current);
 
       // Si no quedan estados activos, la cadena es definitivamente rechazada
       if (current.empty()) {
-        if (trace) {
-          std::cout << "Conjunto de estados vacío por lo que rechazado\n";
-        }
+        trace.Empty();
         break;
       }
     }
@@ -194,16 +176,17 @@ namespace p06 {
     const auto& accepting = automaton_.GetAcceptingStates();
     for (auto s : current) {
       if (accepting.find(s) != accepting.end()) {
-        if (trace) {
-          std::cout << "Estado de aceptación encontrado en " << s << " -> Accepted\n";
-        }
+        trace.Accepted(s);
         return true;
       }
     }
-    if (trace) {
-      std::cout << "Ningún estado de aceptación en el conjunto final -> Rejected\n";
-    }
+    trace.Rejected();
     return false;
   }
 
+  // Instancias de Simulate para las políticas disponibles
+  template bool AutomatonSimulator::Simulate<NoTrace>(const std::string&, NoTrace&) const;
+  template bool AutomatonSimulator::Simulate<CoutTrace>(const std::string&, CoutTrace&) const;
+  template bool AutomatonSimulator::Simulate<BinaryTrace>(const std::string&, BinaryTrace&) const;
+
 }
\ No newline at end of file
@@ -17,6 +17,7 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - Traza como política de plantilla (NoTrace/CoutTrace)
 */
 
 /**
@@ -32,6 +33,7 @@
 #include <string>
 
 #include "automata.h"
+#include "trace_policy.h"
 
 namespace p06 {
 
@@ -63,8 +65,19 @@ class AutomatonSimulator {
    *
    * Nota: si la cadena contiene símbolos que no pertenecen al alfabeto, se rechaza.
    */
+  bool Simulate(const std::string& input) const;
+
+  /**
+   * @brief Simula la cadena informando de cada paso a una política de traza.
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @param trace Política que recibe los eventos (ver trace_policy.h)
+   * @return true si la cadena es aceptada, false si es rechazada
+   *
+   * Instanciada en automata_simulator.cc para NoTrace, CoutTrace y BinaryTrace.
+   */
   // Modif
-  bool Simulate(const std::string& input, bool trace = false) const;
+  template <class TracePolicy>
+  bool Simulate(const std::string& input, TracePolicy& trace) const;
 
  private:
   const Automaton& automaton_; // Referencia al autómata a simular
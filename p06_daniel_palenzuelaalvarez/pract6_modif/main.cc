@@ -18,6 +18,8 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - La traza se elige por política (CoutTrace) fuera del bucle de simulación
+ *    16/10/2026 - Opción --trace-file: traza binaria en segundo plano (BinaryTrace)
 */
 
 // MODIFICACIÓN: Añadir una opcion de traza a las opciones de ejecucion, añadir la palabra "trace" como tercer parametro opcional. 
@@ -33,7 +35,10 @@
  * @brief Programa principal: usa FAParser, Automaton y AutomatonSimulator.
  *
  * Uso:
- *  ./p06_automata_simulator input.fa input.txt
+ *  ./p06_automata_simulator input.fa input.txt [--trace | --trace-file traza.bin]
+ *
+ * Con --trace-file la traza se guarda en binario y se lee después con
+ * p06_trace_render.
  *
  * Si se ejecuta sin argumentos, muestra un mensaje de uso.
  */
@@ -47,6 +52,7 @@
 
 #include "automata_simulator.h"
 #include "fa_parser.h"
+#include "trace_log.h"
 
 /**
  * @brief Imprime una línea corta de uso cuando faltan argumentos.
@@ -55,7 +61,8 @@
  */
  // modif
 static void PrintUsage() {
-  std::cout << "Modo de empleo: ./p06_automata_simulator input.fa input.txt --trace\n"
+  std::cout << "Modo de empleo: ./p06_automata_simulator input.fa input.txt "
+            << "[--trace | --trace-file traza.bin]\n"
             << "Pruebe 'p06_automata_simulator --help' para más información.\n";
 }
 
@@ -68,7 +75,9 @@ static void PrintUsage() {
 static void PrintHelp() {
   std::cout << "p06_automata_simulator - Simulador de autómatas finitos (NFA)\n\n"
             << "Uso:\n"
-            << "  ./p06_automata_simulator input.fa input.txt --trace\n\n"
+            << "  ./p06_automata_simulator input.fa input.txt [--trace | --trace-file traza.bin]\n\n"
+            << "  --trace             Traza legible de cada paso por la salida estándar\n"
+            << "  --trace-file FILE   Traza binaria en FILE (ver p06_trace_render)\n\n"
             << "Formato de input.fa: ver especificación de la práctica.\n"
             << "Formato del fichero.txt: una cadena por línea. Usar & para la cadena vacía.\n";
 }
@@ -164,7 +173,7 @@ int main(int argc, char* argv[]) {
     PrintUsage();
     return 1;
   }
-  if (argc != 3 && argc != 4) {
+  if (argc < 3 || argc > 5) {
     PrintUsage();
     return 1;
   }
@@ -175,10 +184,13 @@ int main(int argc, char* argv[]) {
 
   // Modif
   bool trace_mode = false;
-  if (argc == 4) {
+  std::string trace_file; // Traza binaria (--trace-file)
+  if (argc >= 4) {
     std::string opt = argv[3];
-    if (opt == "--trace") {
+    if (opt == "--trace" && argc == 4) {
       trace_mode = true;
+    } else if (opt == "--trace-file" && argc == 5) {
+      trace_file = argv[4];
     } else {
       std::cerr << "Opción desconocida: " << opt << "\n";
       PrintUsage();
@@ -208,6 +220,15 @@ int main(int argc, char* argv[]) {
     return 3;
   }
 
+  // Política de la traza legible (solo se usa con --trace)
+  p06::CoutTrace cout_trace;
+  // Traza binaria: el hilo escritor arranca al abrir el fichero
+  p06::BinaryTrace binary_trace;
+  if (!trace_file.empty() && !binary_trace.Open(trace_file, err)) {
+    std::cerr << err << "\n";
+    return 3;
+  }
+
   // Leemos línea a línea, parseamos y simulamos cada cadena
   std::string line;
   while (std::getline(ifs, line)) {
@@ -216,10 +237,23 @@ int main(int argc, char* argv[]) {
     ParseInputLine(line, original, input);
     // Simulamos la cadena
     // modif
-    bool accepted = simulator.Simulate(input, trace_mode);
+    bool accepted;
+    if (trace_mode) {
+      accepted = simulator.Simulate(input, cout_trace);
+    } else if (!trace_file.empty()) {
+      accepted = simulator.Simulate(input, binary_trace);
+      binary_trace.Result(original, accepted);
+    } else {
+      accepted = simulator.Simulate(input);
+    }
     // Salida es "<línea original> --- Accepted/Rejected"
     std::cout << original << " --- " << (accepted ? "Accepted" : "Rejected") << "\n";
   }
 
+  if (!trace_file.empty() && !binary_trace.Close(err)) {
+    std::cerr << err << "\n";
+    return 3;
+  }
+
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,347 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: trace_log.cc: implementación de BinaryTrace y TraceReader.
+ *    Contiene la codificación de los eventos, el hilo escritor y la lectura.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file trace_log.cc
+ * @brief Implementación del registro binario de traza.
+ */
+
+#include "trace_log.h"
+
+#include <utility>
+
+namespace p06 {
+
+  // Tamaño máximo aceptado para la línea de un registro kResult
+  static constexpr std::uint64_t kMaxTextSize = std::uint64_t{1} << 30;
+
+  BinaryTrace::BinaryTrace() : closing_(false), failed_(false) {
+  }
+
+  /**
+  * @brief Destructor: si sigue abierto, cierra (los errores se ignoran).
+  */
+  BinaryTrace::~BinaryTrace() {
+    std::string ignored;
+    Close(ignored);
+  }
+
+  /**
+  * @brief Crea el fichero, escribe la cabecera y arranca el hilo escritor.
+  */
+  bool BinaryTrace::Open(const std::string& filename, std::string& err_msg) {
+    file_.open(filename, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+      err_msg = "no se puede crear el fichero de traza: " + filename;
+      return false;
+    }
+    file_.write(kTraceMagic, kTraceMagicSize);
+    block_.reserve(kBlockSize);
+    closing_ = false;
+    failed_ = false;
+    writer_ = std::thread(&BinaryTrace::WriterLoop, this);
+    return true;
+  }
+
+  /**
+  * @brief Entrega el último bloque, espera al hilo escritor y cierra.
+  */
+  bool BinaryTrace::Close(std::string& err_msg) {
+    if (!writer_.joinable()) return true;
+    Flush();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closing_ = true;
+    }
+    ready_.notify_one();
+    writer_.join();
+    file_.close();
+    if (failed_ || !file_) {
+      err_msg = "error de escritura en el fichero de traza";
+      return false;
+    }
+    return true;
+  }
+
+  /**
+  * @brief Pasa el bloque actual a la cola del escritor y toma uno libre.
+  *
+  * Si ya hay kMaxPendingBlocks en la cola, espera a que el escritor libere uno.
+  */
+  void BinaryTrace::Flush() {
+    if (block_.empty()) return;
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_.wait(lock, [this] { return pending_.size() < kMaxPendingBlocks; });
+    pending_.push_back(std::move(block_));
+    if (!free_.empty()) {
+      block_ = std::move(free_.back());
+      free_.pop_back();
+    } else {
+      block_ = std::string();
+      block_.reserve(kBlockSize);
+    }
+    lock.unlock();
+    ready_.notify_one();
+  }
+
+  /**
+  * @brief Bucle del hilo escritor: escribe los bloques en orden de llegada.
+  */
+  void BinaryTrace::WriterLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      ready_.wait(lock, [this] { return !pending_.empty() || closing_; });
+      // Al cerrar, Close ya entregó el último bloque: la cola vacía es el final
+      if (pending_.empty()) return;
+      std::string block = std::move(pending_.front());
+      pending_.pop_front();
+      lock.unlock();
+      file_.write(block.data(), static_cast<std::streamsize>(block.size()));
+      bool ok = static_cast<bool>(file_);
+      block.clear();
+      lock.lock();
+      if (!ok) failed_ = true;
+      free_.push_back(std::move(block));
+      space_.notify_one();
+    }
+  }
+
+  void BinaryTrace::PutVarint(std::uint64_t value) {
+    while (value >= 0x80) {
+      PutByte(static_cast<unsigned char>(value | 0x80));
+      value >>= 7;
+    }
+    PutByte(static_cast<unsigned char>(value));
+  }
+
+  void BinaryTrace::PutSet(const Automaton::StateSet& set) {
+    PutVarint(set.size());
+    for (auto s : set) PutVarint(static_cast<std::uint64_t>(s));
+  }
+
+  void BinaryTrace::PutOptionalSet(const Automaton::StateSet* set) {
+    PutByte(set != nullptr ? 1 : 0);
+    if (set != nullptr) PutSet(*set);
+  }
+
+  void BinaryTrace::Start(const Automaton::StateSet& current) {
+    PutEvent(TraceEvent::kStart);
+    PutSet(current);
+    EndRecord();
+  }
+
+  void BinaryTrace::InvalidSymbol(Automaton::Symbol c) {
+    PutEvent(TraceEvent::kInvalidSymbol);
+    PutByte(static_cast<unsigned char>(c));
+    EndRecord();
+  }
+
+  void BinaryTrace::Symbol(Automaton::Symbol c, const Automaton::StateSet& current) {
+    PutEvent(TraceEvent::kSymbol);
+    PutByte(static_cast<unsigned char>(c));
+    PutSet(current);
+    EndRecord();
+  }
+
+  void BinaryTrace::Rule(Automaton::State s, Automaton::Symbol c,
+                         const Automaton::StateSet* dests) {
+    PutEvent(TraceEvent::kRule);
+    PutVarint(static_cast<std::uint64_t>(s));
+    PutByte(static_cast<unsigned char>(c));
+    PutOptionalSet(dests);
+    EndRecord();
+  }
+
+  void BinaryTrace::EpsilonFromCurrent(Automaton::State s, const Automaton::StateSet& dests) {
+    PutEvent(TraceEvent::kEpsilonFromCurrent);
+    PutVarint(static_cast<std::uint64_t>(s));
+    PutSet(dests);
+    EndRecord();
+  }
+
+  void BinaryTrace::DirectTargets(Automaton::Symbol c, const Automaton::StateSet& next) {
+    PutEvent(TraceEvent::kDirectTargets);
+    PutByte(static_cast<unsigned char>(c));
+    PutSet(next);
+    EndRecord();
+  }
+
+  void BinaryTrace::EpsilonFromTarget(Automaton::State s, const Automaton::StateSet* dests) {
+    PutEvent(TraceEvent::kEpsilonFromTarget);
+    PutVarint(static_cast<std::uint64_t>(s));
+    PutOptionalSet(dests);
+    EndRecord();
+  }
+
+  void BinaryTrace::Closure(const Automaton::StateSet& current) {
+    PutEvent(TraceEvent::kClosure);
+    PutSet(current);
+    EndRecord();
+  }
+
+  void BinaryTrace::Empty() {
+    PutEvent(TraceEvent::kEmpty);
+    EndRecord();
+  }
+
+  void BinaryTrace::Accepted(Automaton::State s) {
+    PutEvent(TraceEvent::kAccepted);
+    PutVarint(static_cast<std::uint64_t>(s));
+    EndRecord();
+  }
+
+  void BinaryTrace::Rejected() {
+    PutEvent(TraceEvent::kRejected);
+    EndRecord();
+  }
+
+  void BinaryTrace::Result(const std::string& original, bool accepted) {
+    PutEvent(TraceEvent::kResult);
+    PutVarint(original.size());
+    block_.append(original);
+    PutByte(accepted ? 1 : 0);
+    EndRecord();
+  }
+
+  /**
+  * @brief Abre el fichero y comprueba la cabecera.
+  */
+  bool TraceReader::Open(const std::string& filename, std::string& err_msg) {
+    file_.open(filename, std::ios::binary);
+    if (!file_) {
+      err_msg = "no se puede abrir el fichero de traza: " + filename;
+      return false;
+    }
+    std::string magic(kTraceMagicSize, '\0');
+    file_.read(&magic[0], static_cast<std::streamsize>(kTraceMagicSize));
+    if (!file_ || magic != std::string(kTraceMagic, kTraceMagicSize)) {
+      err_msg = "no es un fichero de traza (cabecera no reconocida): " + filename;
+      return false;
+    }
+    return true;
+  }
+
+  bool TraceReader::GetByte(unsigned char& byte) {
+    auto c = file_.rdbuf()->sbumpc();
+    if (c == std::char_traits<char>::eof()) return false;
+    byte = static_cast<unsigned char>(c);
+    return true;
+  }
+
+  bool TraceReader::GetVarint(std::uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      unsigned char byte;
+      if (!GetByte(byte)) return false;
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+  }
+
+  bool TraceReader::GetSet(Automaton::StateSet& set) {
+    set.clear();
+    std::uint64_t count;
+    if (!GetVarint(count)) return false;
+    for (std::uint64_t i = 0; i < count; ++i) {
+      std::uint64_t s;
+      if (!GetVarint(s)) return false;
+      set.insert(static_cast<Automaton::State>(s));
+    }
+    return true;
+  }
+
+  /**
+  * @brief Lee el siguiente registro.
+  *
+  * El final del fichero solo es válido entre registros; dentro de uno se
+  * informa como fichero truncado.
+  */
+  bool TraceReader::Next(TraceRecord& record, std::string& err_msg) {
+    err_msg.clear();
+    unsigned char tag;
+    if (!GetByte(tag)) return false;
+    record.event = static_cast<TraceEvent>(tag);
+    record.has_set = false;
+    unsigned char byte = 0;
+    std::uint64_t value = 0;
+    bool ok = true;
+    switch (record.event) {
+      case TraceEvent::kStart:
+      case TraceEvent::kClosure:
+        ok = GetSet(record.set);
+        record.has_set = true;
+        break;
+      case TraceEvent::kInvalidSymbol:
+        ok = GetByte(byte);
+        record.symbol = static_cast<Automaton::Symbol>(byte);
+        break;
+      case TraceEvent::kSymbol:
+      case TraceEvent::kDirectTargets:
+        ok = GetByte(byte) && GetSet(record.set);
+        record.symbol = static_cast<Automaton::Symbol>(byte);
+        record.has_set = true;
+        break;
+      case TraceEvent::kRule:
+        ok = GetVarint(value) && GetByte(byte);
+        record.state = static_cast<Automaton::State>(value);
+        record.symbol = static_cast<Automaton::Symbol>(byte);
+        ok = ok && GetByte(byte);
+        record.has_set = byte != 0;
+        if (ok && record.has_set) ok = GetSet(record.set);
+        break;
+      case TraceEvent::kEpsilonFromCurrent:
+        ok = GetVarint(value) && GetSet(record.set);
+        record.state = static_cast<Automaton::State>(value);
+        record.has_set = true;
+        break;
+      case TraceEvent::kEpsilonFromTarget:
+        ok = GetVarint(value) && GetByte(byte);
+        record.state = static_cast<Automaton::State>(value);
+        record.has_set = byte != 0;
+        if (ok && record.has_set) ok = GetSet(record.set);
+        break;
+      case TraceEvent::kAccepted:
+        ok = GetVarint(value);
+        record.state = static_cast<Automaton::State>(value);
+        break;
+      case TraceEvent::kEmpty:
+      case TraceEvent::kRejected:
+        break;
+      case TraceEvent::kResult:
+        ok = GetVarint(value) && value <= kMaxTextSize;
+        if (ok) {
+          record.text.resize(value);
+          file_.read(&record.text[0], static_cast<std::streamsize>(value));
+          ok = static_cast<bool>(file_) && GetByte(byte);
+          record.accepted = byte != 0;
+        }
+        break;
+      default:
+        err_msg = "registro de traza desconocido (" + std::to_string(tag) + ")";
+        return false;
+    }
+    if (!ok) {
+      err_msg = "fichero de traza truncado o corrupto";
+      return false;
+    }
+    return true;
+  }
+
+}
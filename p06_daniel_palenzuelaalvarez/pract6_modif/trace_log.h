@@ -0,0 +1,196 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: trace_log.h: traza binaria de la simulación.
+ *    Contiene la política BinaryTrace, que escribe los eventos en un fichero
+ *    binario desde un hilo escritor, y TraceReader, que los lee.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file trace_log.h
+ * @brief Registro binario de eventos de traza y su lectura.
+ *
+ * Formato del fichero: la cabecera kTraceMagic seguida de registros. Cada
+ * registro es un byte TraceEvent y sus campos; los enteros (estados,
+ * tamaños) van en varint LEB128 y los símbolos como un byte. Un conjunto es
+ * su tamaño y sus estados sin ordenar; los conjuntos opcionales (reglas sin
+ * destino) llevan antes un byte 0/1.
+ */
+
+#ifndef P06_SIMULATOR_TRACE_LOG_H_
+#define P06_SIMULATOR_TRACE_LOG_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "automata.h"
+
+namespace p06 {
+
+// Cabecera del fichero de traza (incluye la versión del formato)
+inline constexpr char kTraceMagic[] = "P06TRC1\n";
+inline constexpr std::size_t kTraceMagicSize = sizeof(kTraceMagic) - 1;
+
+/**
+ * @brief Tipos de registro; coinciden con los métodos de las políticas.
+ */
+enum class TraceEvent : unsigned char {
+  kStart = 1, // conjunto
+  kInvalidSymbol, // símbolo
+  kSymbol, // símbolo, conjunto
+  kRule, // estado, símbolo, conjunto opcional
+  kEpsilonFromCurrent, // estado, conjunto
+  kDirectTargets, // símbolo, conjunto
+  kEpsilonFromTarget, // estado, conjunto opcional
+  kClosure, // conjunto
+  kEmpty, // sin campos
+  kAccepted, // estado
+  kRejected, // sin campos
+  kResult, // línea original (tamaño y bytes), veredicto (byte 0/1)
+};
+
+/**
+ * @brief Política de traza binaria con escritura en segundo plano.
+ *
+ * El hilo de la simulación solo codifica los eventos en un bloque de
+ * memoria; al llenarse (kBlockSize) el bloque pasa a la cola del hilo
+ * escritor. Los bloques escritos vuelven a una lista libre, así que hay a
+ * lo sumo kMaxPendingBlocks en vuelo (un anillo de bloques): si el disco no
+ * da abasto, la simulación espera en lugar de perder eventos.
+ */
+class BinaryTrace {
+ public:
+  static constexpr bool kEnabled = true;
+  static constexpr std::size_t kBlockSize = std::size_t{1} << 16;
+  static constexpr std::size_t kMaxPendingBlocks = 8;
+
+  BinaryTrace();
+  ~BinaryTrace();
+
+  BinaryTrace(const BinaryTrace&) = delete;
+  BinaryTrace& operator=(const BinaryTrace&) = delete;
+
+  /**
+   * @brief Crea el fichero, escribe la cabecera y arranca el hilo escritor.
+   * @param filename Ruta del fichero de traza
+   * @param err_msg En caso de error se escribe aquí una descripción
+   * @return true en caso de éxito
+   */
+  bool Open(const std::string& filename, std::string& err_msg);
+
+  /**
+   * @brief Vacía el bloque actual, espera al hilo escritor y cierra el fichero.
+   * @param err_msg En caso de error se escribe aquí una descripción
+   * @return true si todos los bloques se escribieron
+   */
+  bool Close(std::string& err_msg);
+
+  void Start(const Automaton::StateSet& current);
+  void InvalidSymbol(Automaton::Symbol c);
+  void Symbol(Automaton::Symbol c, const Automaton::StateSet& current);
+  void Rule(Automaton::State s, Automaton::Symbol c, const Automaton::StateSet* dests);
+  void EpsilonFromCurrent(Automaton::State s, const Automaton::StateSet& dests);
+  void DirectTargets(Automaton::Symbol c, const Automaton::StateSet& next);
+  void EpsilonFromTarget(Automaton::State s, const Automaton::StateSet* dests);
+  void Closure(const Automaton::StateSet& current);
+  void Empty();
+  void Accepted(Automaton::State s);
+  void Rejected();
+
+  /**
+   * @brief Registra la línea de salida de una cadena ("<línea> --- veredicto").
+   */
+  void Result(const std::string& original, bool accepted);
+
+ private:
+  void PutEvent(TraceEvent event) { block_.push_back(static_cast<char>(event)); }
+  void PutByte(unsigned char byte) { block_.push_back(static_cast<char>(byte)); }
+  void PutVarint(std::uint64_t value);
+  void PutSet(const Automaton::StateSet& set);
+  void PutOptionalSet(const Automaton::StateSet* set);
+  // Cierra el registro actual: entrega el bloque si está lleno
+  void EndRecord() {
+    if (block_.size() >= kBlockSize) Flush();
+  }
+  void Flush();
+  void WriterLoop();
+
+  std::ofstream file_;
+  std::string block_; // Bloque en construcción (hilo de la simulación)
+  std::thread writer_;
+  std::mutex mutex_;
+  std::condition_variable ready_; // Hay bloques pendientes o se cierra
+  std::condition_variable space_; // Hay hueco en la cola
+  std::deque<std::string> pending_; // Bloques por escribir
+  std::vector<std::string> free_; // Bloques escritos, para reutilizar
+  bool closing_;
+  bool failed_; // Error de escritura (lo consulta Close)
+};
+
+/**
+ * @brief Registro leído de un fichero de traza.
+ *
+ * Solo son significativos los campos del tipo de evento (ver TraceEvent);
+ * has_set indica si el conjunto opcional estaba presente.
+ */
+struct TraceRecord {
+  TraceEvent event;
+  Automaton::Symbol symbol;
+  Automaton::State state;
+  bool has_set;
+  Automaton::StateSet set;
+  std::string text;
+  bool accepted;
+};
+
+/**
+ * @brief Lector secuencial de ficheros escritos por BinaryTrace.
+ */
+class TraceReader {
+ public:
+  /**
+   * @brief Abre el fichero y comprueba la cabecera.
+   * @param filename Ruta del fichero de traza
+   * @param err_msg En caso de error se escribe aquí una descripción
+   * @return true en caso de éxito
+   */
+  bool Open(const std::string& filename, std::string& err_msg);
+
+  /**
+   * @brief Lee el siguiente registro.
+   * @param record Salida: el registro leído
+   * @param err_msg Vacío al llegar al final; si no, descripción del error
+   * @return true si se leyó un registro
+   */
+  bool Next(TraceRecord& record, std::string& err_msg);
+
+ private:
+  bool GetByte(unsigned char& byte);
+  bool GetVarint(std::uint64_t& value);
+  bool GetSet(Automaton::StateSet& set);
+
+  std::ifstream file_;
+};
+
+}
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: trace_policy.cc: implementación de la política CoutTrace.
+ *    Contiene el formato legible de la traza (--trace).
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file trace_policy.cc
+ * @brief Implementación de CoutTrace.
+ */
+
+#include "trace_policy.h"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace p06 {
+
+  /**
+  * @brief Formatea un conjunto como {a,b,c} con los estados ordenados.
+  */
+  std::string CoutTrace::FormatSet(const Automaton::StateSet& s) {
+    std::vector<Automaton::State> v(s.begin(), s.end());
+    std::sort(v.begin(), v.end());
+    std::ostringstream oss;
+    oss << "{";
+    for (size_t i = 0; i < v.size(); ++i) {
+      if (i) oss << ",";
+      oss << v[i];
+    }
+    oss << "}";
+    return oss.str();
+  }
+
+  void CoutTrace::Start(const Automaton::StateSet& current) {
+    std::cout << "Estado inicial: " << FormatSet(current) << "\n";
+  }
+
+  void CoutTrace::InvalidSymbol(Automaton::Symbol c) {
+    std::cout << "Símbolo no válido encontrado en la entrada: '" << c << "' -> Rejected\n";
+  }
+
+  void CoutTrace::Symbol(Automaton::Symbol c, const Automaton::StateSet& current) {
+    std::cout << "--------------------------------------------------\n";
+    std::cout << "Símbolo actual: '" << c << "'\n";
+    std::cout << "Estados actuales: " << FormatSet(current) << "\n";
+    std::cout << "Reglas (transiciones desde cada estado con '" << c << "'):\n";
+  }
+
+  void CoutTrace::Rule(Automaton::State s, Automaton::Symbol c,
+                       const Automaton::StateSet* dests) {
+    std::cout << "  (" << s << "," << c << ") -> "
+              << (dests != nullptr ? FormatSet(*dests) : "{}") << "\n";
+  }
+
+  void CoutTrace::EpsilonFromCurrent(Automaton::State s, const Automaton::StateSet& dests) {
+    std::cout << "  (" << s << ",&) -> " << FormatSet(dests)
+              << "  [epsilon desde estado actual]\n";
+  }
+
+  void CoutTrace::DirectTargets(Automaton::Symbol c, const Automaton::StateSet& next) {
+    std::cout << "Destinos directos tras consumir '" << c << "': " << FormatSet(next) << "\n";
+    std::cout << "Reglas (epsilon desde destinos directos):\n";
+  }
+
+  void CoutTrace::EpsilonFromTarget(Automaton::State s, const Automaton::StateSet* dests) {
+    std::cout << "  (" << s << ",&) -> " << (dests != nullptr ? FormatSet(*dests) : "{}")
+              << "\n";
+  }
+
+  void CoutTrace::Closure(const Automaton::StateSet& current) {
+    std::cout << "Estados tras epsilon-clausura: " << FormatSet(current) << "\n";
+  }
+
+  void CoutTrace::Empty() {
+    std::cout << "Conjunto de estados vacío por lo que rechazado\n";
+  }
+
+  void CoutTrace::Accepted(Automaton::State s) {
+    std::cout << "Estado de aceptación encontrado en " << s << " -> Accepted\n";
+  }
+
+  void CoutTrace::Rejected() {
+    std::cout << "Ningún estado de aceptación en el conjunto final -> Rejected\n";
+  }
+
+}
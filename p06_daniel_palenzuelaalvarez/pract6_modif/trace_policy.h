@@ -0,0 +1,89 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: trace_policy.h: políticas de traza del simulador.
+ *    Contiene NoTrace (sin traza) y CoutTrace (traza legible por std::cout),
+ *    que AutomatonSimulator::Simulate recibe como parámetro de plantilla.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file trace_policy.h
+ * @brief Políticas de traza para AutomatonSimulator::Simulate.
+ *
+ * Una política es una clase con un miembro estático kEnabled y un método
+ * por evento de la simulación. Simulate se instancia para cada política: con
+ * NoTrace todos los métodos son vacíos y los bucles que solo existen para la
+ * traza van bajo if constexpr (kEnabled), así que el código generado es el
+ * de un simulador sin traza.
+ */
+
+#ifndef P06_SIMULATOR_TRACE_POLICY_H_
+#define P06_SIMULATOR_TRACE_POLICY_H_
+
+#include <string>
+
+#include "automata.h"
+
+namespace p06 {
+
+/**
+ * @brief Política sin traza: todos los eventos se descartan.
+ */
+struct NoTrace {
+  static constexpr bool kEnabled = false;
+
+  void Start(const Automaton::StateSet&) {}
+  void InvalidSymbol(Automaton::Symbol) {}
+  void Symbol(Automaton::Symbol, const Automaton::StateSet&) {}
+  void Rule(Automaton::State, Automaton::Symbol, const Automaton::StateSet*) {}
+  void EpsilonFromCurrent(Automaton::State, const Automaton::StateSet&) {}
+  void DirectTargets(Automaton::Symbol, const Automaton::StateSet&) {}
+  void EpsilonFromTarget(Automaton::State, const Automaton::StateSet*) {}
+  void Closure(const Automaton::StateSet&) {}
+  void Empty() {}
+  void Accepted(Automaton::State) {}
+  void Rejected() {}
+};
+
+/**
+ * @brief Política de traza legible: escribe cada evento en std::cout.
+ *
+ * Los punteros a StateSet nulos representan que no hay transición ({}).
+ */
+class CoutTrace {
+ public:
+  static constexpr bool kEnabled = true;
+
+  void Start(const Automaton::StateSet& current);
+  void InvalidSymbol(Automaton::Symbol c);
+  void Symbol(Automaton::Symbol c, const Automaton::StateSet& current);
+  void Rule(Automaton::State s, Automaton::Symbol c, const Automaton::StateSet* dests);
+  void EpsilonFromCurrent(Automaton::State s, const Automaton::StateSet& dests);
+  void DirectTargets(Automaton::Symbol c, const Automaton::StateSet& next);
+  void EpsilonFromTarget(Automaton::State s, const Automaton::StateSet* dests);
+  void Closure(const Automaton::StateSet& current);
+  void Empty();
+  void Accepted(Automaton::State s);
+  void Rejected();
+
+  /**
+   * @brief Formatea un conjunto como {a,b,c} con los estados ordenados.
+   */
+  static std::string FormatSet(const Automaton::StateSet& s);
+};
+
+}
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: trace_render.cc: programa p06_trace_render.
+ *    Convierte una traza binaria (--trace-file) al formato legible de
+ *    --trace, con filtros por cadena y por veredicto.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file trace_render.cc
+ * @brief Visor de trazas binarias.
+ *
+ * Uso:
+ *  ./p06_trace_render traza.bin [--string N] [--verdict accepted|rejected] [--results]
+ *
+ * Sin opciones la salida es idéntica a la de
+ *  ./p06_automata_simulator input.fa input.txt --trace
+ * Los eventos se formatean con CoutTrace, así que el formato es el mismo.
+ */
+
+#include <cctype>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "trace_log.h"
+#include "trace_policy.h"
+
+/**
+ * @brief Imprime una línea corta de uso.
+ */
+static void PrintUsage() {
+  std::cout << "Modo de empleo: ./p06_trace_render traza.bin [--string N] "
+            << "[--verdict accepted|rejected] [--results]\n"
+            << "  --string N         Solo la cadena N (la primera es la 1)\n"
+            << "  --verdict V        Solo las cadenas aceptadas o rechazadas\n"
+            << "  --results          Solo las líneas de resultado, sin la traza\n";
+}
+
+/**
+ * @brief Filtros de la línea de órdenes.
+ */
+struct Filter {
+  long string_index = 0; // 0 = todas
+  int verdict = -1; // -1 = todas, 1 = aceptadas, 0 = rechazadas
+  bool results_only = false;
+};
+
+/**
+ * @brief Escribe un registro con el formato de --trace.
+ */
+static void Render(const p06::TraceRecord& r, p06::CoutTrace& out) {
+  using p06::TraceEvent;
+  const p06::Automaton::StateSet* set = r.has_set ? &r.set : nullptr;
+  switch (r.event) {
+    case TraceEvent::kStart: out.Start(r.set); break;
+    case TraceEvent::kInvalidSymbol: out.InvalidSymbol(r.symbol); break;
+    case TraceEvent::kSymbol: out.Symbol(r.symbol, r.set); break;
+    case TraceEvent::kRule: out.Rule(r.state, r.symbol, set); break;
+    case TraceEvent::kEpsilonFromCurrent: out.EpsilonFromCurrent(r.state, r.set); break;
+    case TraceEvent::kDirectTargets: out.DirectTargets(r.symbol, r.set); break;
+    case TraceEvent::kEpsilonFromTarget: out.EpsilonFromTarget(r.state, set); break;
+    case TraceEvent::kClosure: out.Closure(r.set); break;
+    case TraceEvent::kEmpty: out.Empty(); break;
+    case TraceEvent::kAccepted: out.Accepted(r.state); break;
+    case TraceEvent::kRejected: out.Rejected(); break;
+    case TraceEvent::kResult:
+      std::cout << r.text << " --- " << (r.accepted ? "Accepted" : "Rejected") << "\n";
+      break;
+  }
+}
+
+/**
+ * @brief main: lee la traza registro a registro y escribe lo que pasa los filtros.
+ *
+ * Los eventos de una cadena preceden a su registro kResult. Sin filtro por
+ * veredicto se escriben según se leen; con él, se guardan los de la cadena
+ * en curso hasta conocer el veredicto.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 2 || std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h") {
+    PrintUsage();
+    return argc < 2 ? 1 : 0;
+  }
+  std::string trace_file = argv[1];
+  Filter filter;
+  for (int i = 2; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (opt == "--string" && i + 1 < argc) {
+      std::string value = argv[++i];
+      bool numeric = !value.empty() && value.size() < 10;
+      for (char c : value) numeric = numeric && std::isdigit(static_cast<unsigned char>(c));
+      if (!numeric || std::stol(value) < 1) {
+        std::cerr << "Índice de cadena no válido: " << value << "\n";
+        return 1;
+      }
+      filter.string_index = std::stol(value);
+    } else if (opt == "--verdict" && i + 1 < argc) {
+      std::string value = argv[++i];
+      if (value != "accepted" && value != "rejected") {
+        std::cerr << "Veredicto no válido: " << value << "\n";
+        return 1;
+      }
+      filter.verdict = value == "accepted" ? 1 : 0;
+    } else if (opt == "--results") {
+      filter.results_only = true;
+    } else {
+      std::cerr << "Opción desconocida: " << opt << "\n";
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  p06::TraceReader reader;
+  std::string err;
+  if (!reader.Open(trace_file, err)) {
+    std::cerr << err << "\n";
+    return 3;
+  }
+
+  p06::CoutTrace out;
+  p06::TraceRecord record;
+  std::vector<p06::TraceRecord> held; // Eventos de la cadena en curso (filtro por veredicto)
+  long index = 1; // Cadena a la que pertenecen los eventos que se leen
+  while (reader.Next(record, err)) {
+    bool selected = filter.string_index == 0 || filter.string_index == index;
+    if (record.event != p06::TraceEvent::kResult) {
+      if (!selected || filter.results_only) continue;
+      if (filter.verdict >= 0) {
+        held.push_back(record);
+      } else {
+        Render(record, out);
+      }
+      continue;
+    }
+    if (selected && (filter.verdict < 0 || filter.verdict == (record.accepted ? 1 : 0))) {
+      for (const p06::TraceRecord& r : held) Render(r, out);
+      Render(record, out);
+    }
+    held.clear();
+    ++index;
+  }
+  if (!err.empty()) {
+    std::cerr << "Error en " << trace_file << ": " << err << "\n";
+    return 3;
+  }
+  return 0;
+}
@@ -0,0 +1,222 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: alloc_test.cc: prueba de reservas de memoria (make test).
+ *    Comprueba que la simulación no reserva memoria en régimen estacionario.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Casos del motor bitset
+*/
+
+/**
+ * @file alloc_test.cc
+ * @brief Prueba de que Simulate no reserva memoria tras el calentamiento.
+ *
+ * Uso:
+ *  make test   (o ./p06_alloc_test)
+ *
+ * El programa sustituye el operator new global por uno que cuenta las
+ * reservas. Cada caso simula un lote una vez (calentamiento: la memoria de
+ * trabajo alcanza su tamaño) y después lo simula otra vez contando; la
+ * segunda pasada debe hacer 0 reservas. Sale con código 1 si algún caso falla.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "automata.h"
+#include "automata_simulator.h"
+#include "bitset_simulator.h"
+#include "simulation_session.h"
+#include "simulator_scratch.h"
+#include "simulator_stats.h"
+
+// Reservas hechas con operator new en todo el programa
+static std::atomic<std::uint64_t> g_allocations{0};
+
+/**
+ * @brief operator new con cuenta de reservas (new[] y las variantes nothrow
+ * de la biblioteca estándar llaman a este).
+ */
+void* operator new(std::size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+
+using SimulateFn = std::function<bool(std::string_view)>;
+
+/**
+ * @brief Declara alfabeto y estados de un autómata vacío.
+ */
+void Init(p06::Automaton& automaton, const std::string& alphabet, int num_states) {
+  for (char symbol : alphabet) automaton.AddSymbol(symbol);
+  automaton.SetNumStates(num_states);
+  automaton.SetStartState(0);
+}
+
+// NFA aleatorio: dos destinos por estado y símbolo y algunas transiciones &
+void MakeRandom(p06::Automaton& automaton, int n) {
+  Init(automaton, "abcd", n);
+  std::mt19937 rng(static_cast<unsigned>(n));
+  std::uniform_int_distribution<int> state(0, n - 1);
+  for (int q = 0; q < n; ++q) {
+    for (char symbol : std::string("abcd")) {
+      for (int k = 0; k < 2; ++k) automaton.AddTransition(q, symbol, state(rng));
+    }
+    if (rng() % 4 == 0) automaton.AddTransition(q, '&', state(rng));
+    if (rng() % 10 == 0) automaton.AddAcceptingState(q);
+  }
+  automaton.Freeze();
+}
+
+// Cadena & de n estados: con n > 8192 la tabla de cierres queda incompleta
+// y el cierre se calcula con el DFS (pila en SimulatorScratch)
+void MakeEpsilonChain(p06::Automaton& automaton, int n) {
+  Init(automaton, "ab", n);
+  for (int q = 0; q < n; ++q) {
+    if (q + 1 < n) automaton.AddTransition(q, '&', q + 1);
+    automaton.AddTransition(q, 'a', (q * 7) % n);
+    if (q % 3 == 0) automaton.AddTransition(q, 'b', (q + 5) % n);
+  }
+  automaton.AddAcceptingState(n - 1);
+  automaton.Freeze();
+}
+
+std::vector<std::string> MakeBatch(const std::string& alphabet, int length, int count) {
+  std::mt19937 rng(static_cast<unsigned>(length * 31 + count));
+  std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+  std::vector<std::string> batch(count);
+  for (std::string& s : batch) {
+    s.resize(length);
+    for (char& c : s) c = alphabet[pick(rng)];
+  }
+  return batch;
+}
+
+/**
+ * @brief Reservas de la segunda pasada de simulate sobre el lote.
+ */
+std::uint64_t SteadyStateAllocations(const SimulateFn& simulate,
+                                     const std::vector<std::string>& batch) {
+  for (const std::string& s : batch) simulate(s);
+  std::uint64_t before = g_allocations.load(std::memory_order_relaxed);
+  for (const std::string& s : batch) simulate(s);
+  return g_allocations.load(std::memory_order_relaxed) - before;
+}
+
+/**
+ * @brief Ejecuta un caso e informa del resultado.
+ * @return true si no hubo reservas
+ */
+bool Check(const std::string& name, std::uint64_t allocations) {
+  std::cout << (allocations == 0 ? "ok    " : "FALLO ") << name;
+  if (allocations != 0) std::cout << ": " << allocations << " reservas";
+  std::cout << "\n";
+  return allocations == 0;
+}
+
+/**
+ * @brief Todos los casos sobre un autómata.
+ */
+bool CheckAutomaton(const std::string& name, const p06::Automaton& automaton,
+                    const std::vector<std::string>& batch) {
+  bool ok = true;
+  p06::AutomatonSimulator simulator(automaton);
+
+  ok &= Check(name + ": Simulate(input)",
+              SteadyStateAllocations(
+                  [&simulator](std::string_view s) { return simulator.Simulate(s); }, batch));
+
+  p06::SimulatorScratch scratch;
+  ok &= Check(name + ": Simulate(input, scratch)",
+              SteadyStateAllocations([&simulator, &scratch](std::string_view s) {
+                return simulator.Simulate(s, scratch);
+              }, batch));
+
+  p06::SimulatorStats stats;
+  ok &= Check(name + ": Simulate(input, stats)",
+              SteadyStateAllocations([&simulator, &stats](std::string_view s) {
+                return simulator.Simulate(s, stats);
+              }, batch));
+
+  p06::SimulationSession session(simulator);
+  ok &= Check(name + ": SimulationSession",
+              SteadyStateAllocations([&session](std::string_view s) {
+                session.Reset();
+                session.Feed(s.data(), s.size());
+                return session.IsAccepting();
+              }, batch));
+
+  // Otro hilo: su memoria de trabajo thread_local se calienta por separado
+  std::uint64_t thread_allocations = 0;
+  std::thread worker([&] {
+    thread_allocations = SteadyStateAllocations(
+        [&simulator](std::string_view s) { return simulator.Simulate(s); }, batch);
+  });
+  worker.join();
+  ok &= Check(name + ": Simulate(input) en otro hilo", thread_allocations);
+
+  if (p06::BitsetSimulator::Supports(automaton)) {
+    p06::BitsetSimulator bitset(automaton);
+    ok &= Check(name + ": bitset Simulate(input)",
+                SteadyStateAllocations(
+                    [&bitset](std::string_view s) { return bitset.Simulate(s); }, batch));
+    p06::BitsetScratch bitset_scratch;
+    ok &= Check(name + ": bitset Simulate(input, scratch)",
+                SteadyStateAllocations([&bitset, &bitset_scratch](std::string_view s) {
+                  return bitset.Simulate(s, bitset_scratch);
+                }, batch));
+  }
+  return ok;
+}
+
+}
+
+/**
+ * @brief Programa principal de la prueba.
+ */
+int main() {
+  bool ok = true;
+  {
+    p06::Automaton automaton;
+    MakeRandom(automaton, 200);
+    ok &= CheckAutomaton("random 200", automaton, MakeBatch("abcd", 256, 50));
+  }
+  {
+    p06::Automaton automaton;
+    MakeEpsilonChain(automaton, 9000);
+    ok &= CheckAutomaton("cadena & 9000 (sin tabla)", automaton, MakeBatch("ab", 8, 20));
+  }
+  std::cout << (ok ? "Todas las pruebas superadas\n" : "Hay pruebas fallidas\n");
+  return ok ? 0 : 1;
+}
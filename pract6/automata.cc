@@ -16,6 +16,13 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - Transiciones congeladas en formato CSR (Freeze)
+ *    16/10/2026 - StateVector y StateVectorHash para construcción de subconjuntos
+ *    16/10/2026 - Clases de equivalencia de símbolos (tabla de 256 entradas)
+ *    16/10/2026 - AssignView: arrays congelados sobre memoria externa
+ *    16/10/2026 - ReserveTransitions
+ *    16/10/2026 - Freeze lineal: clases a partir del CSR por carácter
+ *    16/10/2026 - FreezeFromRows y clases por hash de columna
 */
 
 /**
@@ -28,22 +35,91 @@
 
 #include "automata.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace p06 {
 
+/**
+ * @brief Reparte las transiciones pendientes en filas CSR.
+ *
+ * Hace un counting sort por fila (row_of devuelve la fila de cada transición o
+ * num_rows si hay que descartarla). Las filas quedan en el orden de llegada,
+ * con los repetidos que haya; FreezeFromRows las normaliza.
+ *
+ * @param edges Transiciones pendientes
+ * @param num_rows Número total de filas
+ * @param row_of Función que asigna fila a cada transición
+ * @param offsets Salida: num_rows + 1 desplazamientos
+ * @param targets Salida: destinos agrupados por fila
+ */
+template <typename Edge, typename RowOf>
+static void BuildCsr(const std::vector<Edge>& edges, std::size_t num_rows,
+                     RowOf row_of, std::vector<std::uint32_t>& offsets,
+                     std::vector<Automaton::State>& targets) {
+  // Contamos cuántos destinos tiene cada fila
+  offsets.assign(num_rows + 1, 0);
+  for (const auto& edge : edges) {
+    std::size_t row = row_of(edge);
+    if (row < num_rows) ++offsets[row + 1];
+  }
+  for (std::size_t r = 0; r < num_rows; ++r) offsets[r + 1] += offsets[r];
+
+  // Colocamos cada destino en su fila usando offsets como cursor: al acabar,
+  // offsets[r] es el final de la fila r y basta desplazarlo una posición
+  targets.assign(offsets[num_rows], 0);
+  for (const auto& edge : edges) {
+    std::size_t row = row_of(edge);
+    if (row < num_rows) targets[offsets[row]++] = edge.to;
+  }
+  for (std::size_t r = num_rows; r > 0; --r) offsets[r] = offsets[r - 1];
+  offsets[0] = 0;
+}
+
+/**
+ * @brief Hash de un conjunto ordenado de estados (mezcla tipo FNV-1a).
+ */
+std::size_t Automaton::StateVectorHash::operator()(const StateVector& states) const {
+  std::uint64_t hash = 1469598103934665603ULL;
+  for (auto s : states) {
+    hash ^= static_cast<std::uint32_t>(s);
+    hash *= 1099511628211ULL;
+  }
+  return static_cast<std::size_t>(hash);
+}
+
 // Constructor por defecto: autómata vacío
 Automaton::Automaton()
-    : num_states_(0), start_state_(0) {
+    : num_states_(0), start_state_(0), frozen_(false), num_classes_(0),
+      offsets_data_(nullptr), targets_data_(nullptr), epsilon_offsets_data_(nullptr),
+      epsilon_targets_data_(nullptr), accepting_data_(nullptr), num_transitions_(0) {
+  in_alphabet_.fill(false);
+  class_of_.fill(kNoClass);
 }
 
 // Borra todos los datos del autómata
 void Automaton::Clear() {
   alphabet_.clear();
+  in_alphabet_.fill(false);
   num_states_ = 0;
   start_state_ = 0;
   accepting_states_.clear();
-  transitions_.clear();
+  frozen_ = false;
+  pending_edges_.clear();
+  class_of_.fill(kNoClass);
+  num_classes_ = 0;
+  offsets_.clear();
+  targets_.clear();
+  epsilon_offsets_.clear();
+  epsilon_targets_.clear();
+  accepting_flags_.clear();
+  offsets_data_ = nullptr;
+  targets_data_ = nullptr;
+  epsilon_offsets_data_ = nullptr;
+  epsilon_targets_data_ = nullptr;
+  accepting_data_ = nullptr;
+  num_transitions_ = 0;
+  view_owner_.reset();
 }
 
 /**
@@ -53,12 +129,14 @@ void Automaton::Clear() {
  * @return true si se añadió correctamente, false si fue inválido (por ejemplo &)
  */
 bool Automaton::AddSymbol(Symbol symbol) {
+  if (frozen_) return false;
   if (symbol == '&') {
     // & está reservado para epsilon, no se añade al alfabeto.
     return false;
   }
   // Añadir símbolo al alfabeto
   alphabet_.insert(symbol);
+  in_alphabet_[static_cast<unsigned char>(symbol)] = true;
   return true;
 }
 
@@ -72,7 +150,7 @@ bool Automaton::AddSymbol(Symbol symbol) {
  * @return true en caso de éxito, false si num_states < 1.
  */
 bool Automaton::SetNumStates(int num_states) {
-  if (num_states < 1) return false;
+  if (frozen_ || num_states < 1) return false;
   num_states_ = num_states;
   // Aseguramos start_state_ dentro de rango si ya estaba fijado
   if (start_state_ < 0 || start_state_ >= num_states_) start_state_ = 0;
@@ -88,6 +166,7 @@ bool Automaton::SetNumStates(int num_states) {
  * SetNumStates antes de SetStartState.
  */
 bool Automaton::SetStartState(State state) {
+  if (frozen_) return false;
   if (state < 0 || (num_states_ != 0 && state >= num_states_)) return false;
   start_state_ = state;
   return true;
@@ -97,6 +176,7 @@ bool Automaton::SetStartState(State state) {
  * @brief Marca un estado como de aceptación.
  */
 bool Automaton::AddAcceptingState(State state) {
+  if (frozen_) return false;
   if (state < 0 || (num_states_ != 0 && state >= num_states_)) return false;
   accepting_states_.insert(state);
   return true;
@@ -111,15 +191,236 @@ bool Automaton::AddAcceptingState(State state) {
  *  - permitimos símbolo == & incluso si & no está en el alfabeto
  */
 bool Automaton::AddTransition(State from, Symbol symbol, State to) {
+  if (frozen_) return false;
   if (from < 0 || to < 0) return false;
   if (num_states_ != 0) {
     if (from >= num_states_ || to >= num_states_) return false;
   }
-  // Añadir la transición
-  transitions_[from][symbol].insert(to);
+  // Guardamos la transición hasta que Freeze() construya el CSR
+  pending_edges_.push_back(Edge{from, symbol, to});
   return true;
 }
 
+/**
+ * @brief Reserva espacio para count transiciones pendientes.
+ *
+ * El parser lo llama con el total declarado en el fichero, de modo que
+ * AddTransition no tiene que realojar el vector.
+ */
+void Automaton::ReserveTransitions(std::size_t count) {
+  if (!frozen_) pending_edges_.reserve(count);
+}
+
+/**
+ * @brief Compacta las transiciones pendientes en formato CSR.
+ *
+ * Las transiciones con símbolos fuera del alfabeto o estados fuera de rango
+ * se descartan: la simulación nunca podría usarlas. El resto se reparte con
+ * un counting sort en filas (estado, carácter) y FreezeFromRows termina.
+ */
+void Automaton::Freeze() {
+  if (frozen_) return;
+
+  auto in_range = [this](const Edge& edge) {
+    return edge.from < num_states_ && edge.to < num_states_;
+  };
+
+  // Caracteres con filas propias: alfabeto en orden y '&' al final
+  std::array<int, 256> index_of;
+  index_of.fill(-1);
+  int num_chars = 0;
+  for (Symbol symbol : alphabet_) index_of[static_cast<unsigned char>(symbol)] = num_chars++;
+  index_of[static_cast<unsigned char>('&')] = num_chars++;
+
+  const std::size_t num_char_rows = static_cast<std::size_t>(num_states_) * num_chars;
+  std::vector<std::uint32_t> char_offsets;
+  std::vector<State> char_targets;
+  BuildCsr(pending_edges_, num_char_rows,
+           [&](const Edge& edge) -> std::size_t {
+             int k = index_of[static_cast<unsigned char>(edge.symbol)];
+             if (k < 0 || !in_range(edge)) return num_char_rows;
+             return static_cast<std::size_t>(edge.from) * num_chars +
+                    static_cast<std::size_t>(k);
+           },
+           char_offsets, char_targets);
+  FreezeFromRows(std::move(char_offsets), std::move(char_targets));
+}
+
+/**
+ * @brief Congela el autómata a partir de filas (estado, carácter).
+ *
+ * Pasos, todos lineales en estados x caracteres más transiciones (salvo la
+ * ordenación de cada fila, que es corta):
+ *  -Ordenar y quitar repetidos de cada fila y, en la misma pasada, calcular
+ *   el hash de cada columna (carácter) sobre todos los estados.
+ *  -Clases: un carácter va a la clase de un representante si el hash de sus
+ *   columnas coincide y, comprobado fila a fila, también su contenido.
+ *  -CSR final con las columnas de los representantes (si cada carácter es su
+ *   propia clase, el CSR por carácter se aprovecha tal cual) y CSR de '&'.
+ */
+void Automaton::FreezeFromRows(std::vector<std::uint32_t> char_offsets,
+                               std::vector<State> char_targets) {
+  if (frozen_) return;
+  // Las transiciones pendientes ya no hacen falta
+  std::vector<Edge>().swap(pending_edges_);
+
+  // Caracteres con filas propias: alfabeto en orden y '&' al final
+  std::vector<Symbol> order(alphabet_.begin(), alphabet_.end());
+  order.push_back('&');
+  const std::size_t num_states = static_cast<std::size_t>(num_states_);
+  const std::size_t num_chars = order.size();
+
+  // Una sola pasada por las filas (q, carácter): se ordenan, se quitan
+  // repetidos compactando hacia la izquierda y se acumula el hash de cada
+  // columna (longitud y destinos de sus filas, estado a estado). Las filas
+  // de 0 o 1 destinos (casi todas) no se ordenan, y mientras no aparezca un
+  // repetido no hay nada que desplazar
+  std::vector<std::uint64_t> column_hash(num_chars, 1469598103934665603ULL);
+  std::uint32_t write = 0;
+  for (std::size_t q = 0; q < num_states; ++q) {
+    for (std::size_t k = 0; k < num_chars; ++k) {
+      const std::size_t row = q * num_chars + k;
+      const std::uint32_t begin = char_offsets[row];
+      auto first = char_targets.begin() + begin;
+      auto last = char_targets.begin() + char_offsets[row + 1];
+      if (last - first > 1) {
+        std::sort(first, last);
+        last = std::unique(first, last);
+      }
+      const auto length = static_cast<std::uint32_t>(last - first);
+      if (write != begin) std::copy(first, last, char_targets.begin() + write);
+      char_offsets[row] = write;
+
+      std::uint64_t hash = (column_hash[k] ^ length) * 1099511628211ULL;
+      for (std::uint32_t i = write; i < write + length; ++i) {
+        hash = (hash ^ static_cast<std::uint32_t>(char_targets[i])) * 1099511628211ULL;
+      }
+      column_hash[k] = hash;
+      write += length;
+    }
+  }
+  char_offsets[num_states * num_chars] = write;
+  char_targets.resize(write);
+  char_targets.shrink_to_fit();
+
+  // true si los caracteres a y b tienen la misma fila en todos los estados
+  auto same_rows = [&](std::size_t a, std::size_t b) {
+    for (std::size_t q = 0; q < num_states; ++q) {
+      std::size_t row_a = q * num_chars + a;
+      std::size_t row_b = q * num_chars + b;
+      if (!std::equal(char_targets.begin() + char_offsets[row_a],
+                      char_targets.begin() + char_offsets[row_a + 1],
+                      char_targets.begin() + char_offsets[row_b],
+                      char_targets.begin() + char_offsets[row_b + 1])) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // Clases: se numeran por su primer carácter (alfabeto en orden y '&' al
+  // final). Solo se comparan columnas con el mismo hash
+  std::vector<std::size_t> representative; // Carácter (índice en order) de cada clase
+  class_of_.fill(kNoClass);
+  for (std::size_t k = 0; k < num_chars; ++k) {
+    int found = kNoClass;
+    for (std::size_t c = 0; c < representative.size() && found == kNoClass; ++c) {
+      if (column_hash[representative[c]] == column_hash[k] &&
+          same_rows(representative[c], k)) {
+        found = static_cast<int>(c);
+      }
+    }
+    if (found == kNoClass) {
+      found = static_cast<int>(representative.size());
+      representative.push_back(k);
+    }
+    class_of_[static_cast<unsigned char>(order[k])] = found;
+  }
+  num_classes_ = static_cast<int>(representative.size());
+
+  // Copia las filas de los caracteres indicados (uno por columna) a un CSR
+  auto extract = [&](const std::vector<std::size_t>& columns,
+                     std::vector<std::uint32_t>& offsets, std::vector<State>& targets) {
+    offsets.assign(num_states * columns.size() + 1, 0);
+    std::size_t total = 0;
+    for (std::size_t q = 0; q < num_states; ++q) {
+      for (std::size_t c = 0; c < columns.size(); ++c) {
+        std::size_t row = q * num_chars + columns[c];
+        total += char_offsets[row + 1] - char_offsets[row];
+        offsets[q * columns.size() + c + 1] = static_cast<std::uint32_t>(total);
+      }
+    }
+    targets.resize(total);
+    auto out = targets.begin();
+    for (std::size_t q = 0; q < num_states; ++q) {
+      for (std::size_t column : columns) {
+        std::size_t row = q * num_chars + column;
+        out = std::copy(char_targets.begin() + char_offsets[row],
+                        char_targets.begin() + char_offsets[row + 1], out);
+      }
+    }
+  };
+
+  // Filas & separadas, una por estado, para el cálculo de cierres. Filas
+  // (q, clase): las del representante; sin caracteres agrupados coinciden
+  // con las filas por carácter y no hace falta copiarlas
+  extract(std::vector<std::size_t>(1, num_chars - 1), epsilon_offsets_, epsilon_targets_);
+  if (representative.size() == num_chars) {
+    offsets_ = std::move(char_offsets);
+    targets_ = std::move(char_targets);
+  } else {
+    extract(representative, offsets_, targets_);
+  }
+
+  accepting_flags_.assign(num_states, 0);
+  for (State state : accepting_states_) {
+    if (HasState(state)) accepting_flags_[state] = 1;
+  }
+
+  offsets_data_ = offsets_.data();
+  targets_data_ = targets_.data();
+  epsilon_offsets_data_ = epsilon_offsets_.data();
+  epsilon_targets_data_ = epsilon_targets_.data();
+  accepting_data_ = accepting_flags_.data();
+  num_transitions_ = targets_.size();
+  frozen_ = true;
+}
+
+/**
+ * @brief Sustituye el contenido por una vista congelada.
+ *
+ * Solo se copian la tabla de clases y el alfabeto (como mucho 256
+ * símbolos); los arrays CSR se usan en su sitio.
+ */
+void Automaton::AssignView(FrozenView view) {
+  Clear();
+  num_states_ = view.num_states;
+  start_state_ = view.start_state;
+  num_classes_ = view.num_classes;
+  class_of_ = view.class_of;
+  for (int c = 0; c < 256; ++c) {
+    if (class_of_[c] != kNoClass && c != static_cast<unsigned char>('&')) {
+      alphabet_.insert(static_cast<Symbol>(c));
+      in_alphabet_[c] = true;
+    }
+  }
+  offsets_data_ = view.offsets;
+  targets_data_ = view.targets;
+  epsilon_offsets_data_ = view.epsilon_offsets;
+  epsilon_targets_data_ = view.epsilon_targets;
+  accepting_data_ = view.accepting;
+  num_transitions_ = view.num_transitions;
+  view_owner_ = std::move(view.owner);
+  frozen_ = true;
+}
+
+/**
+ * @brief IsFrozen: true si el autómata ya fue congelado.
+ */
+bool Automaton::IsFrozen() const {
+  return frozen_;
+}
+
 // Getters
 /**
  * @brief GetNumStates: devuelve el número de estados.
@@ -142,6 +443,15 @@ const Automaton::StateSet& Automaton::GetAcceptingStates() const {
   return accepting_states_;
 }
 
+/**
+ * @brief Comprueba si un estado es de aceptación.
+ */
+bool Automaton::IsAcceptingState(State state) const {
+  if (!HasState(state)) return false;
+  if (frozen_) return accepting_data_[state] != 0;
+  return accepting_states_.find(state) != accepting_states_.end();
+}
+
 /**
  * @brief Devuelve el alfabeto.
  */
@@ -167,22 +477,69 @@ bool Automaton::HasState(State state) const {
  */
 bool Automaton::IsSymbolInAlphabet(Symbol symbol) const {
   if (symbol == '&') return true;  // permitimos comprobación externa para epsilon
-  return alphabet_.find(symbol) != alphabet_.end();
+  return in_alphabet_[static_cast<unsigned char>(symbol)];
 }
 
 /**
- * @brief Devuelve el mapa símbolo, conjunto de estados para un estado dado.
+ * @brief Devuelve el número de clases de símbolos (incluida la de '&').
+ */
+int Automaton::GetNumClasses() const {
+  return num_classes_;
+}
+
+/**
+ * @brief Devuelve la clase de un símbolo (kNoClass si no es válido).
+ */
+int Automaton::GetClass(Symbol symbol) const {
+  return class_of_[static_cast<unsigned char>(symbol)];
+}
+
+/**
+ * @brief Devuelve la tabla completa carácter -> clase.
+ */
+const Automaton::ClassTable& Automaton::GetClassTable() const {
+  return class_of_;
+}
+
+/**
+ * @brief Devuelve los destinos de la fila (state, class_id).
+ *
+ * Precondición: autómata congelado, state y clase en rango. No comprueba
+ * nada porque se usa en el bucle interno de la simulación.
+ */
+Automaton::StateRange Automaton::GetTargets(State state, int class_id) const {
+  std::size_t row = static_cast<std::size_t>(state) * num_classes_ +
+                    static_cast<std::size_t>(class_id);
+  return StateRange(targets_data_ + offsets_data_[row], targets_data_ + offsets_data_[row + 1]);
+}
+
+/**
+ * @brief Devuelve los destinos de las transiciones & desde state.
  *
- * Si el estado no tiene transiciones, devuelve un map vacío estático.
+ * Precondición: autómata congelado y state en rango.
  */
-const std::unordered_map<Automaton::Symbol, Automaton::StateSet>&
-Automaton::GetTransitionsForState(State state) const {
-  // Buscar las transiciones para el estado dado
-  static const std::unordered_map<Symbol, StateSet> empty_map;
-  auto it = transitions_.find(state);
-  // Si no hay transiciones, devolver el map vacío
-  if (it == transitions_.end()) return empty_map;
-  return it->second;
+Automaton::StateRange Automaton::GetEpsilonTargets(State state) const {
+  return StateRange(epsilon_targets_data_ + epsilon_offsets_data_[state],
+                    epsilon_targets_data_ + epsilon_offsets_data_[state + 1]);
 }
 
-}
\ No newline at end of file
+/**
+ * @brief Devuelve los destinos desde un estado con un símbolo dado.
+ *
+ * Versión con comprobaciones de GetTargets: si el estado no existe, el
+ * símbolo no es válido o el autómata no está congelado, devuelve un rango vacío.
+ */
+Automaton::StateRange Automaton::GetTransitions(State state, Symbol symbol) const {
+  int class_id = GetClass(symbol);
+  if (!frozen_ || !HasState(state) || class_id == kNoClass) return StateRange();
+  return GetTargets(state, class_id);
+}
+
+/**
+ * @brief Devuelve el número de transiciones compactadas (sin duplicados).
+ */
+std::size_t Automaton::GetNumTransitions() const {
+  return num_transitions_;
+}
+
+}
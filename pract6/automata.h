@@ -16,6 +16,12 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - Transiciones congeladas en formato CSR (Freeze)
+ *    16/10/2026 - StateVector y StateVectorHash para construcción de subconjuntos
+ *    16/10/2026 - Clases de equivalencia de símbolos (tabla de 256 entradas)
+ *    16/10/2026 - Arrays congelados como vista sobre memoria externa (AssignView)
+ *    16/10/2026 - ReserveTransitions (reserva única desde el parser)
+ *    16/10/2026 - FreezeFromRows: congelado desde un CSR por carácter ya contado
 */
 
 /**
@@ -25,16 +31,28 @@
  * Esta clase representa un autómata finito no determinista (NFA) con operaciones
  * básicas para construirlo y consultarlo. La validación detallada de la
  * entrada se deja al parser.
- * 
+ *
+ * Las transiciones se acumulan mientras se construye el autómata y, una vez
+ * completo, Freeze() las compacta en formato CSR (compressed sparse row):
+ * una fila por par (estado, clase de símbolo) con los destinos ordenados y
+ * contiguos en memoria, y un array aparte para las transiciones &.
+ *
+ * Dos caracteres están en la misma clase si tienen exactamente las mismas
+ * transiciones en todos los estados; los motores indexan sus tablas por
+ * clase, así que las filas tienen tantas columnas como clases distintas.
  */
 
 #ifndef P06_AUTOMATON_AUTOMATON_H_
 #define P06_AUTOMATON_AUTOMATON_H_
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <set>
 #include <string>
-#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace p06 {
 
@@ -45,18 +63,81 @@ namespace p06 {
  *  - State: tipo para identificadores de estado (int)
  *  - Symbol: tipo para símbolos de entrada (char)
  *  - StateSet: conjunto de estados (unordered_set<State>)
+ *  - StateVector: conjunto de estados como vector ordenado
+ *  - StateRange: rango de solo lectura sobre los destinos de una fila CSR
+ *
+ * Ciclo de vida: se puebla con los setters y después se congela con Freeze().
+ * Los getters de transiciones solo son válidos con el autómata congelado y,
+ * una vez congelado, los setters devuelven false.
  */
 class Automaton {
  public:
   using State = int; // Tipo para identificadores de estado
   using Symbol = char; // Tipo para símbolos de entrada
   using StateSet = std::unordered_set<State>; // Conjunto de estados
+  using StateVector = std::vector<State>; // Conjunto de estados ordenado
+  using ClassTable = std::array<int, 256>; // Carácter -> clase (kNoClass si no es válido)
+
+  /**
+   * @brief Hash de un StateVector (para indexar subconjuntos de estados).
+   */
+  struct StateVectorHash {
+    std::size_t operator()(const StateVector& states) const;
+  };
+
+  /**
+   * @brief Rango contiguo de estados destino (vista sobre el array CSR).
+   */
+  class StateRange {
+   public:
+    StateRange() = default;
+    StateRange(const State* first, const State* last)
+        : first_(first), last_(last) {}
+    const State* begin() const { return first_; }
+    const State* end() const { return last_; }
+    std::size_t size() const { return static_cast<std::size_t>(last_ - first_); }
+    bool empty() const { return first_ == last_; }
+
+   private:
+    const State* first_ = nullptr;
+    const State* last_ = nullptr;
+  };
+
+  /**
+   * @brief Arrays congelados guardados fuera del autómata (fichero .fab).
+   *
+   * Mismo contenido que deja Freeze(), pero los punteros apuntan a memoria
+   * de owner (por ejemplo, un fichero proyectado), que el autómata mantiene
+   * viva mientras la usa.
+   */
+  struct FrozenView {
+    int num_states = 0;
+    State start_state = 0;
+    int num_classes = 0;
+    ClassTable class_of{}; // Carácter -> clase
+    const std::uint32_t* offsets = nullptr; // num_states * num_classes + 1 entradas
+    const State* targets = nullptr; // num_transitions entradas
+    const std::uint32_t* epsilon_offsets = nullptr; // num_states + 1 entradas
+    const State* epsilon_targets = nullptr; // Destinos por &
+    const std::uint8_t* accepting = nullptr; // num_states entradas (0 o 1)
+    std::size_t num_transitions = 0;
+    std::shared_ptr<const void> owner; // Dueño de la memoria apuntada
+  };
+
+  // Clase devuelta por GetClass para símbolos que no son de entrada
+  static constexpr int kNoClass = -1;
 
   /**
    * @brief Construye un autómata vacío.
    */
   Automaton();
 
+  // Los arrays congelados se referencian con punteros: no se copia
+  Automaton(const Automaton&) = delete;
+  Automaton& operator=(const Automaton&) = delete;
+  Automaton(Automaton&&) = default;
+  Automaton& operator=(Automaton&&) = default;
+
   /**
    * @brief Borra todos los datos del autómata (vuelve al estado inicial vacío).
    */
@@ -72,32 +153,115 @@ class Automaton {
   bool SetStartState(State state); // Establece estado inicial
   bool AddAcceptingState(State state); // Añade estado de aceptación
   bool AddTransition(State from, Symbol symbol, State to); // Añade transición
+  void ReserveTransitions(std::size_t count); // Reserva para count transiciones
+
+  /**
+   * @brief Compacta las transiciones en formato CSR y congela el autómata.
+   *
+   * Agrupa los símbolos en clases de equivalencia (numeradas según el primer
+   * carácter de cada una: alfabeto en orden y '&' el último), ordena y
+   * elimina duplicados de cada fila. Tras llamarlo ya no se admiten más
+   * cambios (hasta Clear()).
+   */
+  void Freeze();
+
+  /**
+   * @brief Congela el autómata a partir de filas (estado, carácter) ya contadas.
+   *
+   * Alternativa a AddTransition + Freeze() para quien puede repartir las
+   * transiciones directamente (el parser). Con m = |alfabeto| + 1, la fila
+   * q * m + k ocupa targets[offsets[q * m + k], offsets[q * m + k + 1]) y
+   * tiene los destinos de q con el k-ésimo símbolo de GetAlphabet(); la
+   * columna k = m - 1 es la de '&'. Las filas pueden estar desordenadas y
+   * tener repetidos, pero los destinos deben estar en rango. Las
+   * transiciones añadidas con AddTransition se descartan.
+   *
+   * @param offsets num_states * m + 1 desplazamientos
+   * @param targets Destinos de todas las filas
+   */
+  void FreezeFromRows(std::vector<std::uint32_t> offsets, std::vector<State> targets);
+  bool IsFrozen() const; // true si Freeze() ya fue llamado
+
+  /**
+   * @brief Sustituye el contenido por una vista congelada, sin copiar los arrays.
+   *
+   * El llamante debe haber validado la vista (rangos de estados y clases).
+   * GetAcceptingStates() queda vacío: la aceptación se consulta con
+   * IsAcceptingState().
+   */
+  void AssignView(FrozenView view);
 
   /**
    * @name Getters
    */
   int GetNumStates() const; // Devuelve número de estados
   State GetStartState() const; // Devuelve estado inicial
-  const StateSet& GetAcceptingStates() const; // Devuelve estados de aceptación
+  const StateSet& GetAcceptingStates() const; // Estados de aceptación (no en vistas)
+  bool IsAcceptingState(State state) const; // true si state es de aceptación
   const std::set<Symbol>& GetAlphabet() const; // Devuelve el alfabeto
   bool HasState(State state) const; // true si estado está en rango
   bool IsSymbolInAlphabet(Symbol symbol) const;  // true si símbolo está en alfabeto
+
   /**
-   * @brief Devuelve el mapa símbolo, conjunto de estados para un estado dado.
-   * @note Si el estado no tiene transiciones, devuelve un map vacío estático.
+   * @name Acceso a las transiciones congeladas (CSR)
+   *
+   * Las clases van de 0 a GetNumClasses() - 1. La fila de la clase de '&'
+   * coincide con GetEpsilonTargets, de modo que una '&' en la cadena de
+   * entrada consume una transición & igual que en la versión original del
+   * simulador.
    */
-  const std::unordered_map<Symbol, StateSet>& GetTransitionsForState(State state) const;
+  int GetNumClasses() const; // Número de clases de símbolos (incluida la de '&')
+  int GetClass(Symbol symbol) const; // Clase del símbolo o kNoClass
+  const ClassTable& GetClassTable() const; // Tabla carácter -> clase
+  StateRange GetTargets(State state, int class_id) const; // Fila (q, clase)
+  StateRange GetEpsilonTargets(State state) const; // Destinos por & desde q
+  StateRange GetTransitions(State state, Symbol symbol) const; // Fila (q, símbolo)
+  std::size_t GetNumTransitions() const; // Número de transiciones (sin duplicados)
 
  private:
+  // Transición pendiente de compactar (solo antes de Freeze)
+  struct Edge {
+    State from;
+    Symbol symbol;
+    State to;
+  };
+
   // Atributos privados
   std::set<Symbol> alphabet_; // Alfabeto del autómata
+  std::array<bool, 256> in_alphabet_; // in_alphabet_[c]: c está en el alfabeto
   int num_states_; // Número de estados
   State start_state_; // Estado inicial
   StateSet accepting_states_; // Conjunto de estados de aceptación
+  bool frozen_; // true tras Freeze()
+
+  // Transiciones añadidas con AddTransition, a la espera de Freeze()
+  std::vector<Edge> pending_edges_;
+
+  // Tabla de 256 entradas: carácter -> clase (kNoClass si no es válido)
+  ClassTable class_of_;
+  int num_classes_; // Número de clases (alfabeto + '&' agrupados)
+
+  // CSR principal: la fila (q, c) ocupa targets_[offsets_[q * num_classes_ + c],
+  // offsets_[q * num_classes_ + c + 1]). Ejemplo: fila (0, clase de '1') = {1, 2}
+  std::vector<std::uint32_t> offsets_;
+  std::vector<State> targets_;
+
+  // CSR de transiciones &: una fila por estado
+  std::vector<std::uint32_t> epsilon_offsets_;
+  std::vector<State> epsilon_targets_;
+
+  // accepting_flags_[q] != 0 si q es de aceptación (consulta O(1))
+  std::vector<std::uint8_t> accepting_flags_;
 
-  // transitions_[q][a] = conjunto de estados destino desde q con símbolo a
-  // Ejemplo: transitions_[0]['1'] = {1, 2}
-  std::unordered_map<State, std::unordered_map<Symbol, StateSet>> transitions_;
+  // Arrays congelados que usan los getters: apuntan a los vectores anteriores
+  // (Freeze) o a la memoria de view_owner_ (AssignView)
+  const std::uint32_t* offsets_data_;
+  const State* targets_data_;
+  const std::uint32_t* epsilon_offsets_data_;
+  const State* epsilon_targets_data_;
+  const std::uint8_t* accepting_data_;
+  std::size_t num_transitions_;
+  std::shared_ptr<const void> view_owner_;
 };
 
 }
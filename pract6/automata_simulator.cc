@@ -17,6 +17,15 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - Lectura directa de las transiciones CSR del autómata
+ *    16/10/2026 - Cierre por & como unión de filas de la tabla precalculada
+ *    16/10/2026 - Validación del alfabeto dentro del bucle de simulación
+ *    16/10/2026 - Getter GetAutomaton
+ *    16/10/2026 - Contadores opcionales (plantilla con kStats)
+ *    16/10/2026 - Conjuntos en SimulatorScratch (marcas por generación, sin reservas)
+ *    16/10/2026 - AddClosure delega en EpsilonClosureTable::AppendClosure
+ *    16/10/2026 - Paso con EpsilonClosureTable::Step
+ *    16/10/2026 - Un símbolo fuera del alfabeto no cuenta como consumido (--stats)
 */
 
 /**
@@ -28,15 +37,51 @@
 
 #include "automata_simulator.h"
 
-#include <queue>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 
 namespace p06 {
 
 /**
- * @brief Constructor: guarda referencia al autómata.
+ * @brief Constructor: guarda referencia al autómata y precalcula los cierres.
  */
 AutomatonSimulator::AutomatonSimulator(const Automaton& automaton)
-    : automaton_(automaton) {
+    : automaton_(automaton), closure_table_(automaton) {
+}
+
+/**
+ * @brief Devuelve el autómata simulado.
+ */
+const Automaton& AutomatonSimulator::GetAutomaton() const {
+  return automaton_;
+}
+
+/**
+ * @brief Devuelve la tabla de cierres por & precalculada.
+ */
+const EpsilonClosureTable& AutomatonSimulator::GetClosureTable() const {
+  return closure_table_;
+}
+
+/**
+ * @brief Añade a scratch.next el cierre por & de un estado.
+ *
+ * El cierre lo calcula EpsilonClosureTable::AppendClosure (fila de la tabla
+ * o DFS si está incompleta); aquí solo se cuenta, con kStats, el trabajo.
+ */
+template <bool kStats>
+void AutomatonSimulator::AddClosure(Automaton::State state, SimulatorScratch& scratch,
+                                    SimulatorStats* stats) const {
+  if constexpr (kStats) {
+    ++stats->closure_calls;
+    EpsilonClosureTable::Work work;
+    closure_table_.AppendClosure(state, scratch, &work);
+    stats->closure_iterations += work.states;
+    stats->epsilon_edges += work.epsilon_edges;
+  } else {
+    closure_table_.AppendClosure(state, scratch);
+  }
 }
 
 /**
@@ -46,34 +91,12 @@ AutomatonSimulator::AutomatonSimulator(const Automaton& automaton)
  */
 Automaton::StateSet AutomatonSimulator::EpsilonClosure(
     const Automaton::StateSet& states) const {
-  // Copiamos los estados iniciales al closure
-  Automaton::StateSet closure = states;
-  // Cola para procesar estados
-  std::queue<Automaton::State> q;
-  // Inicializar cola con estados dados
-  for (auto s : states) q.push(s);
-
-  // Procesar la cola
-  while (!q.empty()) {
-    // cur es el estado actual a procesar (current)
-    Automaton::State cur = q.front();
-    q.pop();
-
-    // Obtener transiciones epsilon desde cur
-    const auto& trans_map = automaton_.GetTransitionsForState(cur);
-    // Buscar las transiciones con símbolo &
-    auto it_eps = trans_map.find('&');
-    // Si no hay transiciones epsilon, continuar
-    if (it_eps == trans_map.end()) continue;
-    // Añadir estados destino al closure si no están ya
-    for (const auto& dest : it_eps->second) {
-      if (closure.insert(dest).second) {
-        q.push(dest);
-      }
-    }
-  }
-  // Devolver el conjunto closure
-  return closure;
+  // Unión de los cierres de cada estado
+  SimulatorScratch scratch;
+  scratch.Prepare(automaton_.GetNumStates());
+  scratch.BeginSet();
+  for (auto s : states) AddClosure<false>(s, scratch, nullptr);
+  return Automaton::StateSet(scratch.next.begin(), scratch.next.end());
 }
 
 /**
@@ -82,44 +105,97 @@ Automaton::StateSet AutomatonSimulator::EpsilonClosure(
  * @param input Cadena de entrada (string vacío representa la cadena epsilon)
  * @return true si la cadena es aceptada, false si es rechazada
  */
-bool AutomatonSimulator::Simulate(const std::string& input) const {
+bool AutomatonSimulator::Simulate(std::string_view input) const {
+  thread_local SimulatorScratch scratch;
+  return SimulateImpl<false>(input, scratch, nullptr);
+}
+
+/**
+ * @brief Simula la cadena sobre el autómata con la memoria de trabajo dada.
+ */
+bool AutomatonSimulator::Simulate(std::string_view input, SimulatorScratch& scratch) const {
+  return SimulateImpl<false>(input, scratch, nullptr);
+}
+
+/**
+ * @brief Simula la cadena sobre el autómata contando en stats.
+ */
+bool AutomatonSimulator::Simulate(std::string_view input, SimulatorStats& stats) const {
+  thread_local SimulatorScratch scratch;
+  return SimulateImpl<true>(input, scratch, &stats);
+}
+
+/**
+ * @brief Simulación del NFA por conjuntos de estados.
+ *
+ * Los conjuntos son listas de estados en scratch (current y next); vaciar
+ * next es abrir una generación nueva, así que cada paso cuesta lo mismo que
+ * los estados que toca y no reserva memoria.
+ *
+ * Con kStats == false todas las sentencias de contadores desaparecen en
+ * compilación (if constexpr) y el código es el de la versión sin contadores.
+ */
+template <bool kStats>
+bool AutomatonSimulator::SimulateImpl(std::string_view input, SimulatorScratch& scratch,
+                                      SimulatorStats* stats) const {
+  if constexpr (kStats) ++stats->strings;
+  scratch.Prepare(automaton_.GetNumStates());
   // Inicializar conjunto de estados actuales con epsilon-closure del estado inicial
-  Automaton::StateSet current;
-  current.insert(automaton_.GetStartState());
-  current = EpsilonClosure(current);
+  scratch.BeginSet();
+  AddClosure<kStats>(automaton_.GetStartState(), scratch, stats);
+  scratch.current.swap(scratch.next);
+  if constexpr (kStats) {
+    stats->peak_active = std::max<std::uint64_t>(stats->peak_active, scratch.current.size());
+  }
 
-  // Si la entrada contiene símbolos fuera del alfabeto, rechazar
-  for (char c : input) {
-    if (!automaton_.IsSymbolInAlphabet(c)) {
+  // Procesar cada símbolo. La validación del alfabeto va en el mismo
+  // recorrido: un símbolo sin clase rechaza la cadena
+  const Automaton::ClassTable& class_of = automaton_.GetClassTable();
+  for (const char& c : input) {
+    int class_id = class_of[static_cast<unsigned char>(c)];
+    if (class_id == Automaton::kNoClass) {
+      // fuera del alfabeto: el símbolo no se consume
+      if constexpr (kStats) ++stats->early_rejections;
       return false;
     }
-  }
-
-  // Procesar cada símbolo
-  for (char c : input) {
-    Automaton::StateSet next; // conjunto de estados siguientes
-    // para cada estado actual, obtener transiciones con símbolo c
-    for (auto s : current) {
-      const auto& trans_map = automaton_.GetTransitionsForState(s);
-      auto it_sym = trans_map.find(c);
-      // Si no hay transiciones con el símbolo c, continuar
-      if (it_sym == trans_map.end()) continue;
-      // Añadir estados destino a next
-      for (const auto& dest : it_sym->second) {
-        next.insert(dest);
+    if constexpr (kStats) {
+      ++stats->symbols;
+      stats->states_expanded += scratch.current.size();
+    }
+    // conjunto de estados siguientes (ya cerrado) en scratch.next: el cierre
+    // de los destinos con símbolo c de cada estado actual
+    if constexpr (kStats) {
+      EpsilonClosureTable::Work work;
+      closure_table_.Step(scratch.current, class_id, scratch, &work);
+      stats->closure_calls += work.closures;
+      stats->closure_iterations += work.states;
+      stats->epsilon_edges += work.epsilon_edges;
+    } else {
+      closure_table_.Step(scratch.current, class_id, scratch);
+    }
+    scratch.current.swap(scratch.next);
+    if constexpr (kStats) {
+      stats->peak_active = std::max<std::uint64_t>(stats->peak_active, scratch.current.size());
+    }
+    if (scratch.current.empty()) {
+      // no quedan estados activos
+      if constexpr (kStats) {
+        if (static_cast<std::size_t>(&c - input.data()) + 1 < input.size()) {
+          ++stats->early_rejections;
+        }
       }
+      break;
     }
-    // aplicar epsilon-closure a next
-    current = EpsilonClosure(next);
-    if (current.empty()) break;  // no quedan estados activos
   }
 
   // Comprobar si algún estado actual es de aceptación
-  const auto& accepting = automaton_.GetAcceptingStates();
-  for (auto s : current) {
-    if (accepting.find(s) != accepting.end()) return true;
+  for (auto s : scratch.current) {
+    if (automaton_.IsAcceptingState(s)) {
+      if constexpr (kStats) ++stats->accepted;
+      return true;
+    }
   }
   return false;
 }
 
-}
\ No newline at end of file
+}
@@ -17,6 +17,11 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - Tabla de cierres por & precalculada en la construcción
+ *    16/10/2026 - Simulate recibe std::string_view (sin copias de la cadena)
+ *    16/10/2026 - Getter GetAutomaton (usado por SimulationSession)
+ *    16/10/2026 - Simulate con contadores (SimulatorStats)
+ *    16/10/2026 - Memoria de trabajo reutilizable (SimulatorScratch), sin reservas por llamada
 */
 
 /**
@@ -29,17 +34,24 @@
 #ifndef P06_SIMULATOR_AUTOMATON_SIMULATOR_H_
 #define P06_SIMULATOR_AUTOMATON_SIMULATOR_H_
 
-#include <string>
+#include <string_view>
 
 #include "automata.h"
+#include "epsilon_closure.h"
+#include "simulator_scratch.h"
+#include "simulator_stats.h"
 
 namespace p06 {
 
 /**
  * @brief Clase que simula un Automaton (NFA).
  *
- * Se construye a partir de una referencia constante a Automaton. Implementa
- * epsilon-closure y Simulate.
+ * Se construye a partir de una referencia constante a Automaton ya congelado
+ * (Automaton::Freeze). Implementa epsilon-closure y Simulate.
+ *
+ * El cierre por & de cada estado se calcula una sola vez al construir el
+ * simulador (EpsilonClosureTable); durante la simulación el cierre de un
+ * conjunto es la unión de las filas de la tabla.
  */
 class AutomatonSimulator {
  public:
@@ -49,6 +61,16 @@ class AutomatonSimulator {
    */
   explicit AutomatonSimulator(const Automaton& automaton);
 
+  /**
+   * @brief Devuelve el autómata simulado.
+   */
+  const Automaton& GetAutomaton() const;
+
+  /**
+   * @brief Devuelve la tabla de cierres por & precalculada.
+   */
+  const EpsilonClosureTable& GetClosureTable() const;
+
   /**
    * @brief Calcula el epsilon-closure (cierre por &) de un conjunto de estados.
    * @param states Conjunto inicial de estados
@@ -62,11 +84,45 @@ class AutomatonSimulator {
    * @return true si la cadena es aceptada, false si es rechazada
    *
    * Nota: si la cadena contiene símbolos que no pertenecen al alfabeto, se rechaza.
+   *
+   * Usa la memoria de trabajo del hilo que llama (thread_local), así que a
+   * partir de la primera llamada de cada hilo no reserva memoria.
+   */
+  bool Simulate(std::string_view input) const;
+
+  /**
+   * @brief Igual que Simulate, con una memoria de trabajo dada por el llamante.
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @param scratch Memoria de trabajo (no compartida entre hilos)
+   * @return true si la cadena es aceptada, false si es rechazada
    */
-  bool Simulate(const std::string& input) const;
+  bool Simulate(std::string_view input, SimulatorScratch& scratch) const;
+
+  /**
+   * @brief Igual que Simulate, acumulando los contadores en stats.
+   *
+   * Ambas versiones son instancias de la misma plantilla: sin stats los
+   * contadores no se compilan, así que Simulate(input) no paga nada.
+   *
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @param stats Contadores del hilo que llama (no compartidos entre hilos)
+   * @return true si la cadena es aceptada, false si es rechazada
+   */
+  bool Simulate(std::string_view input, SimulatorStats& stats) const;
 
  private:
+  // Simulación; con kStats cuenta en *stats
+  template <bool kStats>
+  bool SimulateImpl(std::string_view input, SimulatorScratch& scratch,
+                    SimulatorStats* stats) const;
+
+  // Añade a scratch.next el cierre por & de state (tabla o DFS si está incompleta)
+  template <bool kStats>
+  void AddClosure(Automaton::State state, SimulatorScratch& scratch,
+                  SimulatorStats* stats) const;
+
   const Automaton& automaton_; // Referencia al autómata a simular
+  EpsilonClosureTable closure_table_; // Cierre por & de cada estado
 };
 
 }
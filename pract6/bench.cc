@@ -0,0 +1,436 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: bench.cc: programa de medición de rendimiento (make bench).
+ *    Mide todos los motores de simulación sobre familias paramétricas de
+ *    autómatas y escribe los resultados en JSON por la salida estándar.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Familias random-sparse de 65 a 2048 estados
+ *    16/10/2026 - Cada motor se mide en un proceso hijo (pico de memoria propio)
+ *    16/10/2026 - dfa y jit se omiten de antemano en random-sparse desde 65 estados
+*/
+
+/**
+ * @file bench.cc
+ * @brief Banco de pruebas de rendimiento de los motores.
+ *
+ * Uso:
+ *  ./p06_bench [--min-time-ms N] > bench.json
+ *
+ * Familias (construidas en memoria, con semilla fija):
+ *  -random-sparse: NFA aleatorio de n estados, alfabeto {a, b, c, d}, dos
+ *   destinos aleatorios por estado y símbolo (ninguna cadena se queda sin
+ *   estados activos) y un 10 % de estados de aceptación. Tamaños de 16 a
+ *   2048: desde 65 el motor bitset necesita varias palabras por conjunto.
+ *   Con esos tamaños la construcción de subconjuntos llega siempre al
+ *   límite kMaxDfaStates, así que dfa y jit se omiten sin determinizar.
+ *  -epsilon-chain: cadena 0 -&-> 1 -&-> ... -&-> n-1 con i -a-> i e
+ *   i -b-> (i + 1) mod n; el cierre de cada estado es todo su sufijo.
+ *  -blowup: (a|b)*a(a|b)^n, cuyo DFA mínimo tiene 2^(n+1) estados.
+ *
+ * Para cada familia, motor, longitud y tamaño de lote se simula el lote
+ * completo las veces necesarias para llegar a --min-time-ms y se informa de
+ * ns/símbolo y cadenas/s. Cada par (familia, motor) se construye y se mide
+ * en un proceso hijo, de modo que "peak_rss_kb" es el pico de memoria
+ * residente de ese motor con esa familia (ru_maxrss del hijo, que wait4
+ * devuelve) y no arrastra los picos de medidas anteriores. Los motores que
+ * no admiten el autómata se listan con el motivo en "skipped".
+ */
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "automata.h"
+#include "automata_simulator.h"
+#include "bitset_simulator.h"
+#include "dfa.h"
+#include "dfa_jit.h"
+#include "lazy_dfa_simulator.h"
+#include "shift_and_simulator.h"
+
+namespace {
+
+using SimulateFn = std::function<bool(std::string_view)>;
+
+// Semilla fija: los autómatas y las cadenas son iguales en cada ejecución
+constexpr std::uint64_t kSeed = 20261016;
+
+// Límite de la determinización de dfa y jit (más bajo que el del simulador
+// para que una familia que explota no domine el tiempo y la memoria)
+constexpr std::size_t kMaxDfaStates = std::size_t{1} << 16;
+
+/**
+ * @brief Autómata de una familia con su nombre y parámetro.
+ */
+struct Workload {
+  std::string family;
+  int param;
+  std::string alphabet;
+  p06::Automaton automaton;
+  std::string dfa_skipped; // Motivo para no determinizar (vacío: dfa y jit se miden)
+};
+
+/**
+ * @brief Medida de un motor sobre un lote.
+ */
+struct Measurement {
+  double ns_per_symbol;
+  double strings_per_sec;
+  std::size_t accepted; // Cadenas aceptadas del lote (igual en todos los motores)
+};
+
+/**
+ * @brief Declara alfabeto y estados de un autómata vacío.
+ */
+void Init(p06::Automaton& automaton, const std::string& alphabet, int num_states) {
+  for (char symbol : alphabet) automaton.AddSymbol(symbol);
+  automaton.SetNumStates(num_states);
+  automaton.SetStartState(0);
+}
+
+Workload MakeRandomSparse(int n) {
+  Workload w{"random-sparse", n, "abcd", p06::Automaton(), ""};
+  Init(w.automaton, w.alphabet, n);
+  if (n > 64) {
+    w.dfa_skipped = "la construcción de subconjuntos superaría el límite de " +
+                    std::to_string(kMaxDfaStates) + " estados";
+  }
+  std::mt19937_64 rng(kSeed + static_cast<std::uint64_t>(n));
+  std::uniform_int_distribution<int> state(0, n - 1);
+  for (int q = 0; q < n; ++q) {
+    for (char symbol : w.alphabet) {
+      for (int k = 0; k < 2; ++k) w.automaton.AddTransition(q, symbol, state(rng));
+    }
+    if (rng() % 10 == 0) w.automaton.AddAcceptingState(q);
+  }
+  w.automaton.Freeze();
+  return w;
+}
+
+Workload MakeEpsilonChain(int n) {
+  Workload w{"epsilon-chain", n, "ab", p06::Automaton(), ""};
+  Init(w.automaton, w.alphabet, n);
+  for (int q = 0; q < n; ++q) {
+    if (q + 1 < n) w.automaton.AddTransition(q, '&', q + 1);
+    w.automaton.AddTransition(q, 'a', q);
+    w.automaton.AddTransition(q, 'b', (q + 1) % n);
+  }
+  w.automaton.AddAcceptingState(n - 1);
+  w.automaton.Freeze();
+  return w;
+}
+
+Workload MakeBlowup(int n) {
+  Workload w{"blowup", n, "ab", p06::Automaton(), ""};
+  Init(w.automaton, w.alphabet, n + 2);
+  w.automaton.AddTransition(0, 'a', 0);
+  w.automaton.AddTransition(0, 'b', 0);
+  w.automaton.AddTransition(0, 'a', 1);
+  for (int q = 1; q <= n; ++q) {
+    w.automaton.AddTransition(q, 'a', q + 1);
+    w.automaton.AddTransition(q, 'b', q + 1);
+  }
+  w.automaton.AddAcceptingState(n + 1);
+  w.automaton.Freeze();
+  return w;
+}
+
+/**
+ * @brief Lote de count cadenas aleatorias de longitud length sobre alphabet.
+ */
+std::vector<std::string> MakeBatch(const std::string& alphabet, int length, int count) {
+  std::mt19937_64 rng(kSeed ^ (static_cast<std::uint64_t>(length) << 32) ^
+                      static_cast<std::uint64_t>(count));
+  std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+  std::vector<std::string> batch(count);
+  for (std::string& s : batch) {
+    s.resize(length);
+    for (char& c : s) c = alphabet[pick(rng)];
+  }
+  return batch;
+}
+
+/**
+ * @brief Simula el lote repetidamente hasta acumular min_seconds.
+ */
+Measurement Measure(const SimulateFn& simulate, const std::vector<std::string>& batch,
+                    double min_seconds) {
+  using Clock = std::chrono::steady_clock;
+  std::size_t symbols = 0;
+  for (const std::string& s : batch) symbols += s.size();
+  std::size_t accepted = 0;
+  std::size_t rounds = 0;
+  auto begin = Clock::now();
+  double elapsed = 0;
+  do {
+    accepted = 0;
+    for (const std::string& s : batch) accepted += simulate(s) ? 1 : 0;
+    ++rounds;
+    elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+  } while (elapsed < min_seconds);
+  double total_symbols = static_cast<double>(symbols) * static_cast<double>(rounds);
+  double total_strings = static_cast<double>(batch.size()) * static_cast<double>(rounds);
+  return Measurement{total_symbols > 0 ? elapsed * 1e9 / total_symbols : 0.0,
+                     total_strings / elapsed, accepted};
+}
+
+/**
+ * @brief Motor preparado para una familia, o el motivo por el que no se mide.
+ */
+struct Engine {
+  std::string name;
+  SimulateFn simulate; // Vacío si se omite
+  std::string skipped; // Motivo de la omisión
+  double build_ms; // Tiempo de construcción del motor
+};
+
+// Motores medidos, en el orden de la salida
+const char* const kEngineNames[] = {"nfa", "shift-and", "bitset", "lazy-dfa", "dfa", "jit"};
+
+/**
+ * @brief Construye el motor name para el autómata de w.
+ *
+ * Los objetos del motor se guardan en owners para que sobrevivan a las
+ * medidas. jit determiniza primero; su build_ms es solo la compilación.
+ */
+Engine MakeEngine(const Workload& w, const std::string& name,
+                  std::vector<std::shared_ptr<void>>& owners) {
+  using Clock = std::chrono::steady_clock;
+  auto ms_since = [](Clock::time_point begin) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+  };
+  const p06::Automaton& automaton = w.automaton;
+
+  auto begin = Clock::now();
+  if (name == "nfa") {
+    auto nfa = std::make_shared<p06::AutomatonSimulator>(automaton);
+    owners.push_back(nfa);
+    return {name, [nfa](std::string_view s) { return nfa->Simulate(s); }, "",
+            ms_since(begin)};
+  }
+  if (name == "shift-and") {
+    if (!p06::ShiftAndSimulator::Supports(automaton)) {
+      return {name, nullptr, "más de 64 estados", 0};
+    }
+    auto shift_and = std::make_shared<p06::ShiftAndSimulator>(automaton);
+    owners.push_back(shift_and);
+    return {name, [shift_and](std::string_view s) { return shift_and->Simulate(s); }, "",
+            ms_since(begin)};
+  }
+  if (name == "bitset") {
+    if (!p06::BitsetSimulator::Supports(automaton)) {
+      return {name, nullptr, "demasiados estados", 0};
+    }
+    auto bitset = std::make_shared<p06::BitsetSimulator>(automaton);
+    owners.push_back(bitset);
+    return {name, [bitset](std::string_view s) { return bitset->Simulate(s); }, "",
+            ms_since(begin)};
+  }
+  if (name == "lazy-dfa") {
+    auto lazy = std::make_shared<p06::LazyDfaSimulator>(automaton);
+    owners.push_back(lazy);
+    return {name, [lazy](std::string_view s) { return lazy->Simulate(s); }, "",
+            ms_since(begin)};
+  }
+
+  // dfa y jit: se omiten sin determinizar si la familia lo indica
+  if (!w.dfa_skipped.empty()) return {name, nullptr, w.dfa_skipped, 0};
+  auto dfa = std::make_shared<p06::Dfa>();
+  std::string err;
+  if (!p06::Dfa::Determinize(automaton, kMaxDfaStates, *dfa, err)) {
+    return {name, nullptr, err, 0};
+  }
+  owners.push_back(dfa);
+  if (name == "dfa") {
+    return {name, [dfa](std::string_view s) { return dfa->Simulate(s); }, "",
+            ms_since(begin)};
+  }
+  begin = Clock::now();
+  auto jit = std::make_shared<p06::DfaJit>(*dfa);
+  owners.push_back(jit);
+  if (!jit->IsCompiled()) return {name, nullptr, jit->GetFallbackReason(), 0};
+  return {name, [jit](std::string_view s) { return jit->Simulate(s); }, "", ms_since(begin)};
+}
+
+/**
+ * @brief Escapa una cadena para JSON (comillas, barras y control).
+ */
+std::string JsonString(const std::string& s) {
+  std::string out = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out += ' ';
+    } else {
+      out += c;
+    }
+  }
+  return out + "\"";
+}
+
+/**
+ * @brief Construye y mide un motor sobre una familia (lo ejecuta el hijo).
+ *
+ * Devuelve una línea por resultado: el objeto JSON sin la llave de cierre,
+ * precedido de 'M' si es una medida (el padre añade peak_rss_kb) o de 'S'
+ * si el motor se omite.
+ */
+std::string MeasureEngine(const std::function<Workload()>& make, const std::string& name,
+                          double min_seconds) {
+  const int kLengths[] = {16, 1024};
+  const int kBatchSizes[] = {10, 100};
+  Workload w = make();
+  std::vector<std::shared_ptr<void>> owners;
+  Engine engine = MakeEngine(w, name, owners);
+  std::string prefix = "    {\"family\": " + JsonString(w.family) +
+                       ", \"param\": " + std::to_string(w.param) +
+                       ", \"states\": " + std::to_string(w.automaton.GetNumStates()) +
+                       ", \"engine\": " + JsonString(engine.name);
+  if (!engine.simulate) return "S" + prefix + ", \"skipped\": " + JsonString(engine.skipped) + "\n";
+
+  std::ostringstream lines;
+  for (int length : kLengths) {
+    for (int batch_size : kBatchSizes) {
+      std::vector<std::string> batch = MakeBatch(w.alphabet, length, batch_size);
+      Measurement m = Measure(engine.simulate, batch, min_seconds);
+      lines << "M" << prefix
+            << ", \"length\": " << length << ", \"batch\": " << batch_size
+            << ", \"build_ms\": " << engine.build_ms
+            << ", \"ns_per_symbol\": " << m.ns_per_symbol
+            << ", \"strings_per_sec\": " << m.strings_per_sec
+            << ", \"accepted\": " << m.accepted << "\n";
+    }
+  }
+  return lines.str();
+}
+
+/**
+ * @brief Ejecuta MeasureEngine en un proceso hijo.
+ *
+ * @param peak_rss_kb Salida: pico de memoria residente del hijo (KB)
+ * @return Líneas escritas por el hijo; vacío si el hijo falló
+ */
+std::string MeasureInChild(const std::function<Workload()>& make, const std::string& name,
+                           double min_seconds, long& peak_rss_kb) {
+  peak_rss_kb = 0;
+  int fds[2];
+  if (pipe(fds) != 0) return "";
+  pid_t pid = fork();
+  if (pid < 0) {
+    close(fds[0]);
+    close(fds[1]);
+    return "";
+  }
+  if (pid == 0) {
+    close(fds[0]);
+    std::string out = MeasureEngine(make, name, min_seconds);
+    for (std::size_t done = 0; done < out.size();) {
+      ssize_t n = write(fds[1], out.data() + done, out.size() - done);
+      if (n <= 0) _exit(1);
+      done += static_cast<std::size_t>(n);
+    }
+    _exit(0);
+  }
+
+  // Se lee hasta el final antes de esperar: el hijo no debe bloquearse en la tubería
+  close(fds[1]);
+  std::string out;
+  char buffer[4096];
+  ssize_t n;
+  while ((n = read(fds[0], buffer, sizeof(buffer))) > 0) out.append(buffer, n);
+  close(fds[0]);
+  int status = 0;
+  rusage usage{};
+  if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) ||
+      WEXITSTATUS(status) != 0) {
+    return "";
+  }
+  peak_rss_kb = usage.ru_maxrss;
+  return out;
+}
+
+}
+
+/**
+ * @brief Programa principal del banco de pruebas.
+ *
+ * Pasos principales:
+ *  -Lee --min-time-ms (tiempo mínimo por medida, 50 ms por defecto).
+ *  -Para cada familia y motor, lanza un hijo que los construye y los mide
+ *   con cada longitud y tamaño de lote.
+ *  -Escribe un objeto JSON por medida en "results", con el pico de memoria
+ *   del hijo.
+ */
+int main(int argc, char* argv[]) {
+  double min_seconds = 0.05;
+  for (int i = 1; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (opt == "--min-time-ms" && i + 1 < argc) {
+      min_seconds = std::atof(argv[++i]) / 1000.0;
+    } else {
+      std::cerr << "Modo de empleo: ./p06_bench [--min-time-ms N]\n";
+      return 1;
+    }
+  }
+
+  std::vector<std::function<Workload()>> families = {
+      [] { return MakeRandomSparse(16); },  [] { return MakeRandomSparse(65); },
+      [] { return MakeRandomSparse(128); }, [] { return MakeRandomSparse(256); },
+      [] { return MakeRandomSparse(512); }, [] { return MakeRandomSparse(1024); },
+      [] { return MakeRandomSparse(2048); },
+      [] { return MakeEpsilonChain(32); },  [] { return MakeEpsilonChain(256); },
+      [] { return MakeBlowup(4); },         [] { return MakeBlowup(12); },
+  };
+
+  std::ostringstream results;
+  bool first = true;
+  for (const auto& make : families) {
+    for (const char* name : kEngineNames) {
+      long peak_rss_kb = 0;
+      std::string lines = MeasureInChild(make, name, min_seconds, peak_rss_kb);
+      if (lines.empty()) {
+        std::cerr << "Error midiendo el motor " << name << "\n";
+        return 1;
+      }
+      std::istringstream in(lines);
+      std::string line;
+      while (std::getline(in, line)) {
+        results << (first ? "" : ",\n") << line.substr(1);
+        if (line[0] == 'M') results << ", \"peak_rss_kb\": " << peak_rss_kb;
+        results << "}";
+        first = false;
+      }
+    }
+  }
+
+  std::cout << "{\n  \"benchmark\": \"p06_bench\",\n"
+            << "  \"min_time_ms\": " << min_seconds * 1000.0 << ",\n"
+            << "  \"results\": [\n" << results.str() << "\n  ]\n}\n";
+  return 0;
+}
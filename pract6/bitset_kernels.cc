@@ -0,0 +1,242 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: bitset_kernels.cc: implementación de la clase BitsetKernels.
+ *    Contiene los núcleos escalar, AVX2 y AVX-512 y el despacho según la CPU.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    Intel Intrinsics Guide: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Acumuladores en registros por bloque y bloque final incompleto
+*/
+
+/**
+ * @file bitset_kernels.cc
+ * @brief Implementación de los núcleos del paso bit-paralelo.
+ */
+
+#include "bitset_kernels.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define P06_BITSET_X86 1
+#endif
+
+namespace p06 {
+
+using Word = BitsetKernels::Word;
+
+/**
+ * @brief Lista los estados activos de current como desplazamientos de fila.
+ *
+ * @param active Salida: q * stride para cada estado q activo, en orden
+ * @return Número de estados activos
+ */
+static std::size_t CollectActive(const Word* current, std::size_t stride,
+                                 std::uint32_t* active) {
+  std::size_t count = 0;
+  for (std::size_t w = 0; w < stride; ++w) {
+    Word bits = current[w];
+    while (bits != 0) {
+      std::size_t q = w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits));
+      bits &= bits - 1;
+      active[count++] = static_cast<std::uint32_t>(q * stride);
+    }
+  }
+  return count;
+}
+
+/**
+ * @brief Núcleo escalar (cualquier CPU).
+ *
+ * Todos los núcleos recorren next por bloques de palabras: para cada bloque
+ * acumulan en registros el OR de las filas de los estados activos y lo
+ * escriben una sola vez, en lugar de leer y escribir next por cada estado.
+ */
+static bool StepScalar(const Word* current, Word* next, const Word* rows,
+                       std::size_t stride) {
+  std::uint32_t active[BitsetKernels::kMaxWords * 64];
+  const std::size_t count = CollectActive(current, stride, active);
+  Word any = 0;
+  std::size_t k = 0;
+  for (; k + 4 <= stride; k += 4) {
+    Word acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      const Word* row = rows + active[i] + k;
+      acc0 |= row[0];
+      acc1 |= row[1];
+      acc2 |= row[2];
+      acc3 |= row[3];
+    }
+    next[k] = acc0;
+    next[k + 1] = acc1;
+    next[k + 2] = acc2;
+    next[k + 3] = acc3;
+    any |= acc0 | acc1 | acc2 | acc3;
+  }
+  for (; k < stride; ++k) {
+    Word acc = 0;
+    for (std::size_t i = 0; i < count; ++i) acc |= rows[active[i] + k];
+    next[k] = acc;
+    any |= acc;
+  }
+  return any != 0;
+}
+
+#ifdef P06_BITSET_X86
+
+// Carga y escritura sin alinear de 4 palabras (AVX2)
+__attribute__((target("avx2")))
+static inline __m256i Load256(const Word* p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+__attribute__((target("avx2")))
+static inline void Store256(Word* p, __m256i v) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+/**
+ * @brief Núcleo AVX2: bloques de 16 palabras en 4 registros de 256 bits.
+ */
+__attribute__((target("avx2")))
+static bool StepAvx2(const Word* current, Word* next, const Word* rows,
+                     std::size_t stride) {
+  std::uint32_t active[BitsetKernels::kMaxWords * 64];
+  const std::size_t count = CollectActive(current, stride, active);
+  __m256i any = _mm256_setzero_si256();
+  std::size_t k = 0;
+  for (; k + 16 <= stride; k += 16) {
+    __m256i acc0 = _mm256_setzero_si256(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    for (std::size_t i = 0; i < count; ++i) {
+      const Word* row = rows + active[i] + k;
+      acc0 = _mm256_or_si256(acc0, Load256(row));
+      acc1 = _mm256_or_si256(acc1, Load256(row + 4));
+      acc2 = _mm256_or_si256(acc2, Load256(row + 8));
+      acc3 = _mm256_or_si256(acc3, Load256(row + 12));
+    }
+    Store256(next + k, acc0);
+    Store256(next + k + 4, acc1);
+    Store256(next + k + 8, acc2);
+    Store256(next + k + 12, acc3);
+    any = _mm256_or_si256(any, _mm256_or_si256(_mm256_or_si256(acc0, acc1),
+                                               _mm256_or_si256(acc2, acc3)));
+  }
+  for (; k + 4 <= stride; k += 4) {
+    __m256i acc = _mm256_setzero_si256();
+    for (std::size_t i = 0; i < count; ++i) {
+      acc = _mm256_or_si256(acc, Load256(rows + active[i] + k));
+    }
+    Store256(next + k, acc);
+    any = _mm256_or_si256(any, acc);
+  }
+  Word tail = 0;
+  for (; k < stride; ++k) {
+    Word acc = 0;
+    for (std::size_t i = 0; i < count; ++i) acc |= rows[active[i] + k];
+    next[k] = acc;
+    tail |= acc;
+  }
+  return !_mm256_testz_si256(any, any) || tail != 0;
+}
+
+/**
+ * @brief Núcleo AVX-512: bloques de 32 palabras en 4 registros de 512 bits;
+ * el bloque final incompleto se trata con cargas y escrituras enmascaradas.
+ */
+__attribute__((target("avx512f")))
+static bool StepAvx512(const Word* current, Word* next, const Word* rows,
+                       std::size_t stride) {
+  std::uint32_t active[BitsetKernels::kMaxWords * 64];
+  const std::size_t count = CollectActive(current, stride, active);
+  __m512i any = _mm512_setzero_si512();
+  std::size_t k = 0;
+  for (; k + 32 <= stride; k += 32) {
+    __m512i acc0 = _mm512_setzero_si512(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    for (std::size_t i = 0; i < count; ++i) {
+      const Word* row = rows + active[i] + k;
+      acc0 = _mm512_or_si512(acc0, _mm512_loadu_si512(row));
+      acc1 = _mm512_or_si512(acc1, _mm512_loadu_si512(row + 8));
+      acc2 = _mm512_or_si512(acc2, _mm512_loadu_si512(row + 16));
+      acc3 = _mm512_or_si512(acc3, _mm512_loadu_si512(row + 24));
+    }
+    _mm512_storeu_si512(next + k, acc0);
+    _mm512_storeu_si512(next + k + 8, acc1);
+    _mm512_storeu_si512(next + k + 16, acc2);
+    _mm512_storeu_si512(next + k + 24, acc3);
+    any = _mm512_or_si512(any, _mm512_or_si512(_mm512_or_si512(acc0, acc1),
+                                               _mm512_or_si512(acc2, acc3)));
+  }
+  for (; k < stride; k += 8) {
+    const std::size_t left = stride - k;
+    const __mmask8 mask = left >= 8 ? 0xFF : static_cast<__mmask8>((1u << left) - 1);
+    __m512i acc = _mm512_setzero_si512();
+    for (std::size_t i = 0; i < count; ++i) {
+      acc = _mm512_or_si512(acc, _mm512_maskz_loadu_epi64(mask, rows + active[i] + k));
+    }
+    _mm512_mask_storeu_epi64(next + k, mask, acc);
+    any = _mm512_or_si512(any, acc);
+  }
+  return _mm512_test_epi64_mask(any, any) != 0;
+}
+
+#endif
+
+// Núcleo elegido (se calcula una vez)
+struct SelectedStep {
+  BitsetKernels::StepFn step;
+  const char* name;
+};
+
+/**
+ * @brief Elige el núcleo según la CPU y el límite opcional P06_SIMD.
+ */
+static SelectedStep SelectStep() {
+  const char* env = std::getenv("P06_SIMD");
+  std::string limit = env != nullptr ? env : "";
+#ifdef P06_BITSET_X86
+  __builtin_cpu_init();
+  if ((limit.empty() || limit == "avx512") && __builtin_cpu_supports("avx512f")) {
+    return SelectedStep{StepAvx512, "avx512"};
+  }
+  if ((limit.empty() || limit == "avx512" || limit == "avx2") &&
+      __builtin_cpu_supports("avx2")) {
+    return SelectedStep{StepAvx2, "avx2"};
+  }
+#endif
+  return SelectedStep{StepScalar, "scalar"};
+}
+
+static const SelectedStep& GetSelected() {
+  static const SelectedStep selected = SelectStep();
+  return selected;
+}
+
+/**
+ * @brief Devuelve el mejor núcleo disponible.
+ */
+BitsetKernels::StepFn BitsetKernels::GetStep() {
+  return GetSelected().step;
+}
+
+/**
+ * @brief Devuelve el nombre del núcleo elegido.
+ */
+const char* BitsetKernels::GetStepName() {
+  return GetSelected().name;
+}
+
+}
@@ -0,0 +1,85 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: bitset_kernels.h: interfaz de la clase BitsetKernels.
+ *    Contiene los núcleos (escalar, AVX2 y AVX-512) del paso del simulador
+ *    de bitsets y su selección según la CPU en tiempo de ejecución.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    Intel Intrinsics Guide: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Acumuladores en registros y stride sin relleno
+*/
+
+/**
+ * @file bitset_kernels.h
+ * @brief Interfaz de los núcleos SIMD del simulador de bitsets.
+ *
+ * Cada núcleo aplica un paso completo de la simulación: OR de las filas de
+ * sucesores (ya cerradas por &) de los estados activos. Las variantes AVX2 y
+ * AVX-512 se compilan con atributos target, así que el binario sigue
+ * funcionando en CPUs sin esas extensiones.
+ */
+
+#ifndef P06_SIMULATOR_BITSET_KERNELS_H_
+#define P06_SIMULATOR_BITSET_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace p06 {
+
+/**
+ * @brief Núcleos del paso bit-paralelo multipalabra.
+ *
+ * Los conjuntos y filas ocupan exactamente las palabras necesarias para los
+ * estados (stride): los núcleos tratan el resto de un bloque incompleto, en
+ * lugar de recorrer filas rellenas con ceros.
+ */
+class BitsetKernels {
+ public:
+  using Word = std::uint64_t;
+
+  // Palabras máximas por conjunto (4096 estados): acota la lista de estados
+  // activos que los núcleos guardan en la pila
+  static constexpr std::size_t kMaxWords = 64;
+
+  /**
+   * @brief Paso de simulación.
+   *
+   * @param current Conjunto activo (stride palabras)
+   * @param next Salida: OR de rows + q * stride para cada q activo
+   * @param rows Filas de sucesores de la clase de símbolo consumida
+   * @param stride Palabras por conjunto (entre 1 y kMaxWords)
+   * @return true si next no está vacío
+   */
+  using StepFn = bool (*)(const Word* current, Word* next, const Word* rows,
+                          std::size_t stride);
+
+  /**
+   * @brief Devuelve el mejor núcleo disponible en esta CPU.
+   *
+   * Orden de preferencia: AVX-512, AVX2, escalar. La variable de entorno
+   * P06_SIMD (scalar, avx2 o avx512) limita la elección, por ejemplo para
+   * comparar núcleos; nunca se elige uno que la CPU no soporte.
+   */
+  static StepFn GetStep();
+
+  /**
+   * @brief Nombre del núcleo que devuelve GetStep ("scalar", "avx2", "avx512").
+   */
+  static const char* GetStepName();
+};
+
+}
+
+#endif
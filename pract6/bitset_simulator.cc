@@ -0,0 +1,145 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: bitset_simulator.cc: implementación de la clase BitsetSimulator.
+ *    Contiene la implementación del simulador de NFA basado en bitsets.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Validación del alfabeto dentro del bucle de simulación
+ *    16/10/2026 - Paso con núcleos SIMD (BitsetKernels)
+ *    16/10/2026 - Memoria de trabajo reutilizable (BitsetScratch)
+ *    16/10/2026 - Stride igual al número real de palabras
+*/
+
+/**
+ * @file bitset_simulator.cc
+ * @brief Implementación de la precomputación de máscaras y de Simulate.
+ */
+
+#include "bitset_simulator.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "epsilon_closure.h"
+
+namespace p06 {
+
+static_assert(BitsetSimulator::kMaxStates <= BitsetKernels::kMaxWords * 64,
+              "los núcleos no admiten tantos estados");
+
+/**
+ * @brief Comprueba si el autómata es apto para el simulador de bitsets.
+ */
+bool BitsetSimulator::Supports(const Automaton& automaton) {
+  return automaton.IsFrozen() && automaton.GetNumStates() <= kMaxStates;
+}
+
+/**
+ * @brief Constructor: precalcula cierres y máscaras de sucesores.
+ *
+ * Pasos:
+ *  -Cierre por & de cada estado (EpsilonClosureTable).
+ *  -Para cada (q, a): OR de los cierres de los destinos de la fila (q, a).
+ *  -Máscaras del estado inicial (cerrado) y de los estados de aceptación.
+ */
+BitsetSimulator::BitsetSimulator(const Automaton& automaton)
+    : automaton_(automaton), step_(BitsetKernels::GetStep()) {
+  const int num_states = automaton_.GetNumStates();
+  const int num_classes = automaton_.GetNumClasses();
+  const std::size_t words = (static_cast<std::size_t>(num_states) + 63) / 64;
+  stride_ = std::max<std::size_t>(words, 1);
+
+  // Cierre por & de cada estado individual, a partir de la tabla de cierres
+  // (con presupuesto n^2 la tabla siempre queda completa)
+  EpsilonClosureTable closure_table(
+      automaton_, static_cast<std::size_t>(num_states) * num_states);
+  std::vector<Word> closure(static_cast<std::size_t>(num_states) * words, 0);
+  for (int q = 0; q < num_states; ++q) {
+    Word* row = &closure[q * words];
+    for (auto s : closure_table.GetClosure(q)) row[s / 64] |= Word{1} << (s % 64);
+  }
+
+  // Máscara de sucesores de cada (q, a), ya cerrada por &. Las filas de una
+  // misma clase son contiguas: el núcleo recibe solo las de la clase leída
+  successors_.assign(
+      static_cast<std::size_t>(num_classes) * num_states * stride_, 0);
+  for (int a = 0; a < num_classes; ++a) {
+    for (int q = 0; q < num_states; ++q) {
+      Word* row = &successors_[(static_cast<std::size_t>(a) * num_states + q) * stride_];
+      for (auto dest : automaton_.GetTargets(q, a)) {
+        const Word* dest_closure = &closure[dest * words];
+        for (std::size_t w = 0; w < words; ++w) row[w] |= dest_closure[w];
+      }
+    }
+  }
+
+  // Estado inicial cerrado y máscara de aceptación
+  start_.assign(stride_, 0);
+  accepting_.assign(stride_, 0);
+  if (num_states > 0) {
+    const Word* start_closure = &closure[automaton_.GetStartState() * words];
+    std::copy(start_closure, start_closure + words, start_.begin());
+  }
+  for (int q = 0; q < num_states; ++q) {
+    if (automaton_.IsAcceptingState(q)) accepting_[q / 64] |= Word{1} << (q % 64);
+  }
+}
+
+/**
+ * @brief Simula la cadena sobre el autómata con bitsets.
+ *
+ * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+ * @return true si la cadena es aceptada, false si es rechazada
+ */
+bool BitsetSimulator::Simulate(std::string_view input) const {
+  thread_local BitsetScratch scratch;
+  return Simulate(input, scratch);
+}
+
+/**
+ * @brief Simulación con memoria de trabajo externa.
+ *
+ * Los conjuntos solo crecen: si la instancia ya sirvió a un autómata mayor se
+ * usan sus primeras stride_ palabras. El núcleo escribe todas las palabras de
+ * next en cada paso, así que basta con copiar el estado inicial en current.
+ */
+bool BitsetSimulator::Simulate(std::string_view input, BitsetScratch& scratch) const {
+  if (scratch.current.size() < stride_) {
+    scratch.current.resize(stride_);
+    scratch.next.resize(stride_);
+  }
+  Word* current = scratch.current.data();
+  Word* next = scratch.next.data();
+  std::copy(start_.begin(), start_.end(), current);
+  const std::size_t rows_per_class =
+      static_cast<std::size_t>(automaton_.GetNumStates()) * stride_;
+
+  // Procesar cada símbolo: next = OR de las filas de los estados activos
+  const Automaton::ClassTable& class_of = automaton_.GetClassTable();
+  for (char c : input) {
+    int class_id = class_of[static_cast<unsigned char>(c)];
+    if (class_id == Automaton::kNoClass) return false;  // fuera del alfabeto
+    const Word* rows = &successors_[static_cast<std::size_t>(class_id) * rows_per_class];
+    bool any = step_(current, next, rows, stride_);
+    std::swap(current, next);
+    if (!any) return false;  // no quedan estados activos
+  }
+
+  // Aceptación: intersección con la máscara de estados de aceptación
+  for (std::size_t w = 0; w < stride_; ++w) {
+    if (current[w] & accepting_[w]) return true;
+  }
+  return false;
+}
+}
@@ -0,0 +1,113 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: bitset_simulator.h: interfaz de la clase BitsetSimulator.
+ *    Contiene la definición de la clase BitsetSimulator, un simulador de NFA
+ *    que representa los conjuntos de estados como bitsets.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Paso con núcleos SIMD (BitsetKernels)
+ *    16/10/2026 - Simulate recibe std::string_view (sin copias de la cadena)
+*/
+
+/**
+ * @file bitset_simulator.h
+ * @brief Interfaz del simulador basado en bitsets.
+ *
+ * Alternativa a AutomatonSimulator para NFAs de hasta unos miles de estados:
+ * los conjuntos actual/siguiente son arrays de palabras de 64 bits y cada paso
+ * es un OR de máscaras de sucesores precalculadas, hecho por el núcleo SIMD
+ * que BitsetKernels elige para la CPU.
+ */
+
+#ifndef P06_SIMULATOR_BITSET_SIMULATOR_H_
+#define P06_SIMULATOR_BITSET_SIMULATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "automata.h"
+#include "bitset_kernels.h"
+
+namespace p06 {
+
+/**
+ * @brief Memoria de trabajo de BitsetSimulator::Simulate.
+ *
+ * Los dos conjuntos del paso (actual y siguiente) crecen hasta el stride del
+ * simulador la primera vez y después se reutilizan: la simulación no reserva
+ * memoria. Igual que SimulatorScratch, no debe usarse desde dos hilos a la vez.
+ */
+struct BitsetScratch {
+  std::vector<BitsetKernels::Word> current; // Conjunto activo
+  std::vector<BitsetKernels::Word> next; // Conjunto en construcción
+};
+
+/**
+ * @brief Simulador de NFA con conjuntos de estados en bitsets.
+ *
+ * En la construcción calcula, para cada par (estado, símbolo), la máscara de
+ * estados alcanzables consumiendo el símbolo y aplicando después el cierre
+ * por &. La simulación solo hace OR de esas máscaras y un AND final con la
+ * máscara de estados de aceptación. Da el mismo resultado que
+ * AutomatonSimulator::Simulate.
+ */
+class BitsetSimulator {
+ public:
+  // Número máximo de estados admitido (las tablas crecen con n^2)
+  static constexpr int kMaxStates = 4096;
+
+  /**
+   * @brief Comprueba si el autómata es apto para este simulador.
+   * @return true si está congelado y tiene como mucho kMaxStates estados
+   */
+  static bool Supports(const Automaton& automaton);
+
+  /**
+   * @brief Construye las tablas de máscaras a partir del autómata.
+   * @param automaton Autómata congelado con Supports(automaton) == true
+   */
+  explicit BitsetSimulator(const Automaton& automaton);
+
+  /**
+   * @brief Simula la cadena dada sobre el autómata.
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @return true si la cadena es aceptada, false si es rechazada
+   */
+  bool Simulate(std::string_view input) const;
+
+  /**
+   * @brief Igual que Simulate(input), con la memoria de trabajo del llamador.
+   *
+   * Simulate(input) usa una BitsetScratch thread_local; esta variante sirve
+   * para quien ya gestiona su propia memoria por hilo.
+   */
+  bool Simulate(std::string_view input, BitsetScratch& scratch) const;
+
+ private:
+  using Word = BitsetKernels::Word;
+
+  const Automaton& automaton_; // Referencia al autómata a simular
+  std::size_t stride_; // Palabras por conjunto (las justas, mínimo 1)
+  BitsetKernels::StepFn step_; // Núcleo del paso elegido para la CPU
+  // Máscaras ya cerradas por &, agrupadas por clase: [clase][estado][stride_]
+  std::vector<Word> successors_;
+  std::vector<Word> start_; // Cierre por & del estado inicial
+  std::vector<Word> accepting_; // Máscara de estados de aceptación
+};
+
+}
+
+#endif
@@ -0,0 +1,210 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: chunked_dfa_simulator.cc: implementación de la clase ChunkedDfaSimulator.
+ *    Contiene el cálculo de la función de transición de cada bloque y su
+ *    composición.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    T. Mytkowicz, M. Musuvathi, W. Schulte, "Data-parallel finite-state
+ *    machines", ASPLOS 2014
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Abandono de los bloques cuyos caminos no convergen
+ *    16/10/2026 - Presupuesto de especulación y memoria de trabajo por hilo
+*/
+
+/**
+ * @file chunked_dfa_simulator.cc
+ * @brief Implementación del simulador DFA por bloques en paralelo.
+ */
+
+#include "chunked_dfa_simulator.h"
+
+#include <algorithm>
+
+#include "work_stealing_pool.h"
+
+namespace p06 {
+
+/**
+ * @brief Constructor: guarda el DFA y el número de hilos.
+ */
+ChunkedDfaSimulator::ChunkedDfaSimulator(const Dfa& dfa, int num_threads)
+    : dfa_(dfa), num_threads_(std::max(1, num_threads)) {
+}
+
+/**
+ * @brief Función de transición del bloque: map[q] = estado final desde q.
+ *
+ * Cada grupo g empieza siendo {g} y avanza con su estado actual. Cuando el
+ * destino de g ya lo ocupa otro grupo, g se une a él (parent[g]) y deja de
+ * avanzar; si el destino es kDead, el grupo muere. Al final el estado de
+ * cada q es el de la raíz de su grupo.
+ *
+ * El bloque se abandona en cuanto los pasos especulativos acumulados (suma
+ * de caminos vivos por símbolo) superan kSpeculationFactor veces su
+ * longitud, o si tras kProbeSymbols símbolos siguen vivos más caminos que
+ * hilos. Así el trabajo perdido en un bloque abandonado nunca pasa de
+ * kSpeculationFactor veces lo que cuesta simularlo secuencialmente.
+ *
+ * @return false si el bloque se abandona (map queda vacío)
+ */
+bool ChunkedDfaSimulator::ComputeChunkMap(std::string_view chunk, ChunkScratch& scratch,
+                                          std::vector<int>& map) const {
+  const int num_states = dfa_.GetNumStates();
+  const Automaton::ClassTable& class_of = dfa_.GetClassTable();
+
+  // Los vectores solo crecen; las marcas antiguas son de generaciones pasadas
+  auto n = static_cast<std::size_t>(num_states);
+  if (scratch.stamp.size() < n) {
+    scratch.parent.resize(n);
+    scratch.state_of.resize(n);
+    scratch.live.resize(n);
+    scratch.group_at.resize(n);
+    scratch.stamp.resize(n, 0);
+  }
+  std::vector<int>& parent = scratch.parent;
+  std::vector<int>& state_of = scratch.state_of;
+  std::vector<int>& live = scratch.live;
+  std::vector<int>& group_at = scratch.group_at;
+  std::vector<std::uint32_t>& stamp = scratch.stamp;
+  std::uint32_t& generation = scratch.generation;
+  for (int g = 0; g < num_states; ++g) parent[g] = state_of[g] = live[g] = g;
+  std::size_t num_live = n;
+
+  const std::size_t budget = kSpeculationFactor * chunk.size();
+  std::size_t work = 0;
+  std::size_t pos = 0;
+  while (pos < chunk.size() && num_live > 1) {
+    work += num_live;
+    if (work > budget ||
+        (pos == kProbeSymbols && num_live > static_cast<std::size_t>(num_threads_))) {
+      map.clear();
+      return false;
+    }
+    int class_id = class_of[static_cast<unsigned char>(chunk[pos++])];
+    if (++generation == 0) {
+      std::fill(stamp.begin(), stamp.end(), 0);
+      generation = 1;
+    }
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < num_live; ++i) {
+      int g = live[i];
+      int s = class_id == Automaton::kNoClass ? Dfa::kDead
+                                                 : dfa_.GetNext(state_of[g], class_id);
+      if (s == Dfa::kDead) {
+        state_of[g] = Dfa::kDead;  // el grupo muere
+      } else if (stamp[s] == generation) {
+        parent[g] = group_at[s];  // dos caminos convergen
+      } else {
+        stamp[s] = generation;
+        group_at[s] = g;
+        state_of[g] = s;
+        live[kept++] = g;
+      }
+    }
+    num_live = kept;
+  }
+  // Un único camino vivo: el resto del bloque es una simulación normal
+  if (num_live == 1 && pos < chunk.size()) {
+    std::size_t steps = 0;
+    int g = live[0];
+    state_of[g] = dfa_.Advance(state_of[g], chunk.substr(pos), steps);
+  }
+
+  // Estado final de cada estado de partida (raíz con compresión de caminos)
+  map.resize(num_states);
+  for (int q = 0; q < num_states; ++q) {
+    int root = q;
+    while (parent[root] != root) root = parent[root];
+    for (int g = q; g != root;) {
+      int up = parent[g];
+      parent[g] = root;
+      g = up;
+    }
+    map[q] = state_of[root];
+  }
+  return true;
+}
+
+/**
+ * @brief Simula la cadena por bloques y compone sus funciones de transición.
+ *
+ * El primer bloque se simula desde el estado inicial y el resto calculan su
+ * función en paralelo. Como solo interesa el veredicto, la composición se
+ * reduce a seguir un estado a través de las funciones (una consulta por
+ * bloque). Si el DFA muere en el bloque i, se vuelve a simular ese bloque
+ * desde su estado de entrada para saber en qué símbolo.
+ *
+ * Los bloques abandonados por ComputeChunkMap se simulan aquí, en orden,
+ * desde su estado de entrada (ya conocido). Componer así en secuencia es
+ * correcto porque la función de un bloque solo se usa en ese estado. En el
+ * peor caso (ningún bloque converge) se simula toda la cadena con un hilo
+ * después de haber perdido, repartidos entre los hilos, como mucho
+ * kSpeculationFactor pasos por símbolo: el tiempo queda acotado por
+ * (1 + kSpeculationFactor / num_threads_) veces el secuencial. Si el sondeo
+ * de un bloque ya no cabe en ese presupuesto, no se especula.
+ */
+bool ChunkedDfaSimulator::Simulate(std::string_view input, std::uint64_t& consumed) const {
+  consumed = 0;
+  if (dfa_.GetNumStates() == 0) return false;
+
+  std::size_t num_chunks = std::min(static_cast<std::size_t>(4) * num_threads_,
+                                    input.size() / kMinChunkBytes);
+  const std::size_t probe_work =
+      static_cast<std::size_t>(dfa_.GetNumStates()) * kProbeSymbols;
+  if (num_threads_ == 1 || num_chunks < 2 ||
+      probe_work > kSpeculationFactor * (input.size() / num_chunks)) {
+    std::size_t steps = 0;
+    int state = dfa_.Advance(dfa_.GetStartState(), input, steps);
+    consumed = steps;
+    return state != Dfa::kDead && dfa_.IsAccepting(state);
+  }
+
+  // Límites de los bloques: el bloque i es [begin[i], begin[i + 1])
+  std::vector<std::size_t> begin(num_chunks + 1);
+  for (std::size_t i = 0; i <= num_chunks; ++i) begin[i] = input.size() / num_chunks * i;
+  begin[num_chunks] = input.size();
+  auto chunk = [&](std::size_t i) { return input.substr(begin[i], begin[i + 1] - begin[i]); };
+
+  int state = Dfa::kDead;
+  std::size_t first_steps = 0;
+  std::vector<std::vector<int>> maps(num_chunks);
+  std::vector<ChunkScratch> scratch(num_threads_);
+  {
+    // El destructor del pool espera a que terminen todos los bloques
+    WorkStealingPool pool(num_threads_);
+    pool.Submit([&](int) { state = dfa_.Advance(dfa_.GetStartState(), chunk(0), first_steps); });
+    for (std::size_t i = 1; i < num_chunks; ++i) {
+      pool.Submit([&, i](int worker) { ComputeChunkMap(chunk(i), scratch[worker], maps[i]); });
+    }
+  }
+
+  if (state == Dfa::kDead) {
+    consumed = first_steps;
+    return false;
+  }
+  for (std::size_t i = 1; i < num_chunks; ++i) {
+    std::size_t steps = 0;
+    int next = maps[i].empty() ? dfa_.Advance(state, chunk(i), steps) : maps[i][state];
+    if (next == Dfa::kDead) {
+      if (!maps[i].empty()) dfa_.Advance(state, chunk(i), steps);
+      consumed = begin[i] + steps;
+      return false;
+    }
+    state = next;
+  }
+  consumed = input.size();
+  return dfa_.IsAccepting(state);
+}
+
+}
@@ -0,0 +1,111 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: chunked_dfa_simulator.h: interfaz de la clase ChunkedDfaSimulator.
+ *    Contiene la simulación en paralelo de una única cadena muy larga sobre
+ *    un DFA, partida en bloques especulativos.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    T. Mytkowicz, M. Musuvathi, W. Schulte, "Data-parallel finite-state
+ *    machines", ASPLOS 2014
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - kProbeSymbols: abandono de bloques que no convergen
+ *    16/10/2026 - Presupuesto de especulación ligado a la longitud del bloque
+*/
+
+/**
+ * @file chunked_dfa_simulator.h
+ * @brief Interfaz del simulador DFA por bloques en paralelo.
+ *
+ * La cadena se parte en bloques. Cada bloque (salvo el primero) no sabe en
+ * qué estado empieza, así que calcula su función de transición completa:
+ * el estado final para cada estado de partida posible. Después basta con
+ * seguir el estado real a través de esas funciones, bloque a bloque.
+ */
+
+#ifndef P06_SIMULATOR_CHUNKED_DFA_SIMULATOR_H_
+#define P06_SIMULATOR_CHUNKED_DFA_SIMULATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "dfa.h"
+
+namespace p06 {
+
+/**
+ * @brief Simula una sola cadena sobre un Dfa repartiendo bloques entre hilos.
+ *
+ * Calcular la función de un bloque desde los n estados costaría n veces la
+ * simulación secuencial, pero los caminos de un DFA convergen enseguida: se
+ * avanzan a la vez solo los estados actuales distintos y, cuando dos
+ * caminos llegan al mismo estado, se fusionan (union-find sobre los grupos
+ * de estados de partida). Con un único camino vivo el bloque se termina con
+ * el bucle secuencial normal. Si los caminos no convergen (por ejemplo, un
+ * contador módulo n) el bloque se abandona y se simula secuencialmente.
+ *
+ * La especulación de un bloque está acotada: como mucho kSpeculationFactor
+ * pasos (caminos vivos x símbolos) por símbolo del bloque. Si ni siquiera el
+ * sondeo inicial (todos los estados durante kProbeSymbols símbolos) cabe en
+ * ese presupuesto, no se especula y la cadena se simula con un hilo.
+ */
+class ChunkedDfaSimulator {
+ public:
+  // Tamaño mínimo de bloque: por debajo no compensa especular
+  static constexpr std::size_t kMinChunkBytes = std::size_t{1} << 20;
+  // Símbolos de cada bloque tras los que se comprueba si los caminos convergen
+  static constexpr std::size_t kProbeSymbols = 4096;
+  // Pasos especulativos permitidos por símbolo del bloque antes de abandonarlo
+  static constexpr std::size_t kSpeculationFactor = 1;
+
+  /**
+   * @brief Prepara el simulador.
+   * @param dfa DFA (debe sobrevivir al simulador)
+   * @param num_threads Hilos de simulación (al menos uno)
+   */
+  ChunkedDfaSimulator(const Dfa& dfa, int num_threads);
+
+  /**
+   * @brief Simula la cadena dada sobre el DFA.
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @param consumed Salida: símbolos consumidos; si la cadena se rechaza
+   *        antes del final, posición (desde 1) del símbolo que dejó al DFA
+   *        sin estado, como SimulationSession::GetConsumed
+   * @return true si la cadena es aceptada, false si es rechazada
+   */
+  bool Simulate(std::string_view input, std::uint64_t& consumed) const;
+
+ private:
+  // Memoria de trabajo de ComputeChunkMap, una por hilo del pool
+  struct ChunkScratch {
+    std::vector<int> parent; // Grupo al que se unió cada grupo
+    std::vector<int> state_of; // Estado actual (o final) de cada raíz
+    std::vector<int> live; // Grupos que siguen avanzando
+    std::vector<int> group_at; // Grupo que ocupa cada estado
+    std::vector<std::uint32_t> stamp; // Marca por símbolo de group_at
+    std::uint32_t generation = 0; // Marca del símbolo actual
+  };
+
+  // Calcula en map el estado final del bloque para cada estado de partida;
+  // false si lo abandona porque los caminos no convergen
+  bool ComputeChunkMap(std::string_view chunk, ChunkScratch& scratch,
+                       std::vector<int>& map) const;
+
+  const Dfa& dfa_; // DFA simulado
+  int num_threads_; // Hilos de simulación
+};
+
+}
+
+#endif
@@ -0,0 +1,252 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: cpp_emitter.cc: implementación de la clase CppEmitter.
+ *    Contiene la escritura del reconocedor switch/goto y de su programa de prueba.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    P. Bumbulis, D. D. Cowan, "RE2C: a more versatile scanner generator", 1993
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file cpp_emitter.cc
+ * @brief Implementación del generador de código C++.
+ */
+
+#include "cpp_emitter.h"
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace p06 {
+
+/**
+ * @brief Escribe buffer en filename.
+ */
+static bool WriteText(const std::string& buffer, const std::string& filename,
+                      std::string& err_msg) {
+  std::ofstream ofs(filename, std::ios::binary);
+  if (!ofs) {
+    err_msg = "No se puede crear fichero: " + filename;
+    return false;
+  }
+  ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  if (!ofs) {
+    err_msg = "Error escribiendo fichero: " + filename;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Literal de un byte para una etiqueta case: 'a' si es imprimible, 0xNN si no.
+ */
+static std::string ByteLiteral(int byte) {
+  char text[8];
+  if (byte >= 0x20 && byte < 0x7F && byte != '\'' && byte != '\\') {
+    std::snprintf(text, sizeof(text), "'%c'", byte);
+  } else {
+    std::snprintf(text, sizeof(text), "0x%02X", byte);
+  }
+  return text;
+}
+
+/**
+ * @brief Literal de cadena C++; los bytes no imprimibles van en octal (\ooo).
+ */
+static std::string StringLiteral(std::string_view s) {
+  std::string literal = "\"";
+  for (char ch : s) {
+    unsigned char byte = static_cast<unsigned char>(ch);
+    if (byte >= 0x20 && byte < 0x7F && byte != '"' && byte != '\\' && byte != '?') {
+      literal += ch;
+    } else {
+      char text[8];
+      std::snprintf(text, sizeof(text), "\\%03o", byte);
+      literal += text;
+    }
+  }
+  literal += '"';
+  return literal;
+}
+
+/**
+ * @brief Comprueba que name sea un identificador C++ ([A-Za-z_][A-Za-z0-9_]*).
+ */
+bool CppEmitter::IsValidName(std::string_view name) {
+  if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) return false;
+  for (char c : name) {
+    if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Genera la cabecera del reconocedor.
+ *
+ * Pasos:
+ *  -Recorrido en anchura desde el estado inicial: los estados alcanzables se
+ *   numeran en ese orden (el inicial queda como s0) y el resto se descarta.
+ *  -Por cada estado, una etiqueta (si hay algún goto a él); al final de la cadena se devuelve si es
+ *   de aceptación y, si no, un switch sobre el byte leído con un case por
+ *   byte del alfabeto, agrupados por destino, y default de rechazo.
+ */
+bool CppEmitter::WriteMatcher(const Dfa& dfa, const std::string& name,
+                              const std::string& source, const std::string& filename,
+                              std::string& err_msg) {
+  if (!IsValidName(name)) {
+    err_msg = "Nombre de reconocedor no válido: " + name;
+    return false;
+  }
+  const int num_states = dfa.GetNumStates();
+  const int num_classes = dfa.GetNumClasses();
+  const Automaton::ClassTable& class_of = dfa.GetClassTable();
+
+  // Estados alcanzables, en anchura desde el inicial. Solo llevan etiqueta
+  // los destinos de algún goto (s0 se alcanza sin salto)
+  std::vector<int> new_id(num_states, -1);
+  std::vector<std::uint8_t> referenced(num_states, 0);
+  std::vector<int> order;
+  if (num_states > 0) {
+    new_id[dfa.GetStartState()] = 0;
+    order.push_back(dfa.GetStartState());
+  }
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    for (int c = 0; c < num_classes; ++c) {
+      int target = dfa.GetNext(order[i], c);
+      if (target == Dfa::kDead) continue;
+      referenced[target] = 1;
+      if (new_id[target] < 0) {
+        new_id[target] = static_cast<int>(order.size());
+        order.push_back(target);
+      }
+    }
+  }
+
+  std::string guard = "P06_MATCHER_";
+  for (char c : name) guard += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+  guard += "_H_";
+
+  std::string out;
+  out += "// Reconocedor generado por p06_automata_simulator --emit-cpp a partir de\n"
+         "// " + source + " (DFA de " + std::to_string(order.size()) + " estados).\n"
+         "// No editar a mano: volver a generarlo si cambia el autómata.\n\n";
+  out += "#ifndef " + guard + "\n#define " + guard + "\n\n";
+  out += "#include <string_view>\n\n";
+  out += "namespace " + name + " {\n\n";
+  out += "// true si el autómata acepta input\n";
+  out += "inline bool Match(std::string_view input) {\n";
+  // Lenguaje vacío sin transiciones: ni siquiera se lee la cadena
+  bool empty = order.empty() || (order.size() == 1 && !referenced[order[0]] &&
+                                 !dfa.IsAccepting(order[0]));
+  if (empty) {
+    out += "  static_cast<void>(input);\n  return false;\n";
+    order.clear();
+  } else {
+    out += "  const unsigned char* p = reinterpret_cast<const unsigned char*>(input.data());\n"
+           "  const unsigned char* const end = p + input.size();\n";
+  }
+
+  std::vector<int> targets; // Destinos del estado, en el orden de su primer byte
+  std::vector<int> slot(order.size(), -1); // Posición de cada destino en targets
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    int state = order[i];
+    const char* verdict = dfa.IsAccepting(state) ? "true" : "false";
+    if (referenced[state]) out += "s" + std::to_string(i) + ":\n";
+
+    // Bytes del alfabeto agrupados por destino
+    targets.clear();
+    std::vector<std::vector<int>> bytes;
+    for (int byte = 0; byte < 256; ++byte) {
+      int class_id = class_of[byte];
+      if (class_id == Automaton::kNoClass) continue;
+      int target = dfa.GetNext(state, class_id);
+      if (target == Dfa::kDead) continue;
+      int id = new_id[target];
+      if (slot[id] < 0) {
+        slot[id] = static_cast<int>(targets.size());
+        targets.push_back(id);
+        bytes.emplace_back();
+      }
+      bytes[slot[id]].push_back(byte);
+    }
+    for (int id : targets) slot[id] = -1;
+    if (targets.empty()) {
+      out += dfa.IsAccepting(state) ? "  return p == end;\n" : "  return false;\n";
+      continue;
+    }
+    out += "  if (p == end) return " + std::string(verdict) + ";\n";
+    out += "  switch (*p++) {\n";
+    for (std::size_t t = 0; t < targets.size(); ++t) {
+      const std::vector<int>& group = bytes[t];
+      for (std::size_t b = 0; b < group.size(); ++b) {
+        out += "    case " + ByteLiteral(group[b]) + ":";
+        out += b + 1 < group.size() ? "\n" : " goto s" + std::to_string(targets[t]) + ";\n";
+      }
+    }
+    out += "    default: return false;\n  }\n";
+  }
+  out += "}\n\n}\n\n#endif\n";
+  return WriteText(out, filename, err_msg);
+}
+
+/**
+ * @brief Genera el programa de prueba con los casos como tabla constante.
+ *
+ * La tabla lleva un centinela final para que sea válida aunque no haya casos.
+ */
+bool CppEmitter::WriteTest(const std::string& name, const std::string& header,
+                           const std::vector<TestCase>& cases, const std::string& filename,
+                           std::string& err_msg) {
+  if (!IsValidName(name)) {
+    err_msg = "Nombre de reconocedor no válido: " + name;
+    return false;
+  }
+  std::string out;
+  out += "// Prueba generada por p06_automata_simulator --emit-cpp: compara " + name +
+         "::Match\n// con el veredicto de AutomatonSimulator::Simulate para cada cadena.\n\n";
+  out += "#include <cstddef>\n#include <cstdio>\n#include <string_view>\n\n";
+  out += "#include \"" + header + "\"\n\n";
+  out += "namespace {\n\n"
+         "struct Case {\n"
+         "  const char* input;\n"
+         "  std::size_t size;\n"
+         "  bool accepted;\n"
+         "};\n\n";
+  out += "constexpr std::size_t kNumCases = " + std::to_string(cases.size()) + ";\n";
+  out += "constexpr Case kCases[] = {\n";
+  for (const TestCase& test : cases) {
+    out += "    {" + StringLiteral(test.input) + ", " + std::to_string(test.input.size()) +
+           ", " + (test.accepted ? "true" : "false") + "},\n";
+  }
+  out += "    {\"\", 0, false},  // Centinela\n};\n\n}\n\n";
+  out += "int main() {\n"
+         "  std::size_t failures = 0;\n"
+         "  for (std::size_t i = 0; i < kNumCases; ++i) {\n"
+         "    const Case& test = kCases[i];\n"
+         "    if (" + name + "::Match(std::string_view(test.input, test.size)) != test.accepted) {\n"
+         "      std::printf(\"FALLO: \\\"%.*s\\\" (esperado %s)\\n\", static_cast<int>(test.size),\n"
+         "                  test.input, test.accepted ? \"Accepted\" : \"Rejected\");\n"
+         "      ++failures;\n"
+         "    }\n"
+         "  }\n"
+         "  std::printf(\"%zu/%zu cadenas correctas\\n\", kNumCases - failures, kNumCases);\n"
+         "  return failures == 0 ? 0 : 1;\n"
+         "}\n";
+  return WriteText(out, filename, err_msg);
+}
+
+}
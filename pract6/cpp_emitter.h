@@ -0,0 +1,97 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: cpp_emitter.h: interfaz de la clase CppEmitter.
+ *    Contiene la generación de un reconocedor C++ especializado a partir de
+ *    un DFA, y de su programa de prueba.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    P. Bumbulis, D. D. Cowan, "RE2C: a more versatile scanner generator", 1993
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file cpp_emitter.h
+ * @brief Interfaz del generador de código C++.
+ *
+ * El reconocedor generado es una cabecera autónoma (solo depende de la
+ * biblioteca estándar): cada estado del DFA es una etiqueta y cada
+ * transición un goto dentro de un switch sobre el byte leído, al estilo de
+ * re2c. No hay tablas ni referencias a Automaton en el camino crítico.
+ */
+
+#ifndef P06_CODEGEN_CPP_EMITTER_H_
+#define P06_CODEGEN_CPP_EMITTER_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "dfa.h"
+
+namespace p06 {
+
+/**
+ * @brief Generador de reconocedores C++ (switch/goto) a partir de un Dfa.
+ */
+class CppEmitter {
+ public:
+  /**
+   * @brief Cadena de prueba con el veredicto esperado.
+   */
+  struct TestCase {
+    std::string input;
+    bool accepted;
+  };
+
+  /**
+   * @brief true si name es un identificador C++ válido (espacio de nombres).
+   */
+  static bool IsValidName(std::string_view name);
+
+  /**
+   * @brief Escribe la cabecera con name::Match(std::string_view).
+   *
+   * Solo se generan los estados alcanzables desde el inicial.
+   *
+   * @param dfa DFA a traducir
+   * @param name Espacio de nombres del reconocedor (identificador C++)
+   * @param source Fichero de origen, citado en el comentario inicial
+   * @param filename Fichero de salida (cabecera)
+   * @param err_msg En caso de error se escribe aquí una descripción
+   * @return true en caso de éxito
+   */
+  static bool WriteMatcher(const Dfa& dfa, const std::string& name,
+                           const std::string& source, const std::string& filename,
+                           std::string& err_msg);
+
+  /**
+   * @brief Escribe un programa que comprueba name::Match sobre los casos dados.
+   *
+   * El programa incluye la cabecera por su nombre (sin directorio), imprime
+   * las cadenas que fallan y termina con código 1 si alguna falla.
+   *
+   * @param name Espacio de nombres del reconocedor
+   * @param header Nombre de la cabecera generada con WriteMatcher
+   * @param cases Cadenas y veredictos esperados
+   * @param filename Fichero de salida (.cc)
+   * @param err_msg En caso de error se escribe aquí una descripción
+   * @return true en caso de éxito
+   */
+  static bool WriteTest(const std::string& name, const std::string& header,
+                        const std::vector<TestCase>& cases, const std::string& filename,
+                        std::string& err_msg);
+};
+
+}
+
+#endif
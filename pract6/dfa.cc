@@ -0,0 +1,321 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: dfa.cc: implementación de la clase Dfa.
+ *    Contiene la construcción de subconjuntos, la simulación con tabla densa
+ *    y la lectura/escritura del formato binario .dfa.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Tabla indexada por clase de símbolo (formato .dfa versión 2)
+ *    16/10/2026 - Método Advance
+ *    16/10/2026 - Fnv1a64 compartida con el formato .fab (fnv1a.h)
+ *    16/10/2026 - Determinize con SimulatorScratch (marcas compartidas con el simulador)
+ *    16/10/2026 - Sucesores con EpsilonClosureTable::Step
+*/
+
+/**
+ * @file dfa.cc
+ * @brief Implementación del DFA con tabla densa.
+ *
+ * Formato .dfa (binario, enteros en el orden de bytes de la máquina):
+ *  - 8 bytes: "P06DFA" seguido de dos bytes 0
+ *  - uint32: versión (2)
+ *  - int32: número de estados, número de clases, estado inicial
+ *  - 256 int32: clase de cada carácter (-1 = fuera del alfabeto)
+ *  - num_states bytes: aceptación de cada estado (0 o 1)
+ *  - num_states * num_classes int32: tabla de transiciones (-1 = muerto)
+ *  - uint64: suma de comprobación FNV-1a de todo lo anterior
+ */
+
+#include "dfa.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+
+#include "epsilon_closure.h"
+#include "fnv1a.h"
+#include "simulator_scratch.h"
+
+namespace p06 {
+
+// Cabecera y versión del formato .dfa
+static const char kDfaMagic[8] = {'P', '0', '6', 'D', 'F', 'A', 0, 0};
+static constexpr std::uint32_t kDfaVersion = 2;
+
+/**
+ * @brief Añade al buffer la representación binaria de un valor.
+ */
+template <typename T>
+static void AppendRaw(std::string& buffer, const T& value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Lee un valor binario del buffer avanzando pos.
+ * @return false si no quedan bytes suficientes
+ */
+template <typename T>
+static bool ReadRaw(const std::string& buffer, std::size_t& pos, T& value) {
+  if (buffer.size() - pos < sizeof(T)) return false;
+  std::memcpy(&value, buffer.data() + pos, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+// Constructor por defecto: DFA vacío
+Dfa::Dfa() : num_classes_(0), num_states_(0), start_(0) {
+  class_of_.fill(Automaton::kNoClass);
+}
+
+/**
+ * @brief Construcción de subconjuntos (solo estados alcanzables).
+ *
+ * Cada estado del DFA es un conjunto ordenado de estados del NFA cerrado por
+ * &. El conjunto vacío no se representa: las transiciones a él valen kDead.
+ */
+bool Dfa::Determinize(const Automaton& nfa, std::size_t max_states, Dfa& dfa,
+                      std::string& err_msg) {
+  const int num_classes = nfa.GetNumClasses();
+  EpsilonClosureTable closure_table(nfa);
+
+  std::unordered_map<Automaton::StateVector, int, Automaton::StateVectorHash> ids;
+  std::vector<const Automaton::StateVector*> sets;
+  std::vector<int> next;
+  std::vector<std::uint8_t> accepting;
+  // Subconjunto en construcción: scratch.next
+  SimulatorScratch scratch;
+  scratch.Prepare(nfa.GetNumStates());
+  const Automaton::StateVector& subset = scratch.next;
+
+  // Registra el subconjunto como estado del DFA (si es nuevo) y devuelve su número
+  auto intern = [&]() -> int {
+    auto it = ids.find(subset);
+    if (it != ids.end()) return it->second;
+    int id = static_cast<int>(sets.size());
+    it = ids.emplace(subset, id).first;
+    sets.push_back(&it->first);
+    bool is_accepting = std::any_of(subset.begin(), subset.end(),
+        [&nfa](Automaton::State s) { return nfa.IsAcceptingState(s); });
+    accepting.push_back(is_accepting ? 1 : 0);
+    next.resize(next.size() + num_classes, kDead);
+    return id;
+  };
+
+  // Estado inicial: cierre del estado inicial del NFA
+  scratch.BeginSet();
+  closure_table.AppendClosure(nfa.GetStartState(), scratch);
+  std::sort(scratch.next.begin(), scratch.next.end());
+  intern();
+
+  // Recorrido en anchura: los estados nuevos se añaden al final de sets
+  for (std::size_t d = 0; d < sets.size(); ++d) {
+    for (int a = 0; a < num_classes; ++a) {
+      closure_table.Step(*sets[d], a, scratch);
+      if (subset.empty()) continue;  // transición al conjunto vacío
+      std::sort(scratch.next.begin(), scratch.next.end());
+      int id = intern();
+      if (sets.size() > max_states) {
+        err_msg = "La construcción de subconjuntos supera el límite de " +
+                  std::to_string(max_states) + " estados del DFA.";
+        return false;
+      }
+      next[d * num_classes + a] = id;
+    }
+  }
+
+  dfa.Assign(nfa.GetClassTable(), num_classes, static_cast<int>(sets.size()), 0,
+             std::move(next), std::move(accepting));
+  return true;
+}
+
+/**
+ * @brief Sustituye el contenido del DFA.
+ */
+void Dfa::Assign(const Automaton::ClassTable& class_of, int num_classes, int num_states,
+                 int start, std::vector<int> next, std::vector<std::uint8_t> accepting) {
+  class_of_ = class_of;
+  num_classes_ = num_classes;
+  num_states_ = num_states;
+  start_ = start;
+  next_ = std::move(next);
+  accepting_ = std::move(accepting);
+}
+
+/**
+ * @brief Simula la cadena con una consulta a la tabla por símbolo.
+ *
+ * Los símbolos fuera del alfabeto se detectan en el mismo recorrido.
+ */
+bool Dfa::Simulate(std::string_view input) const {
+  if (num_states_ == 0) return false;
+  const std::size_t num_classes = static_cast<std::size_t>(num_classes_);
+  int state = start_;
+  for (char c : input) {
+    int class_id = class_of_[static_cast<unsigned char>(c)];
+    if (class_id == Automaton::kNoClass) return false;  // fuera del alfabeto
+    state = next_[static_cast<std::size_t>(state) * num_classes + class_id];
+    if (state == kDead) return false;  // no quedan estados activos
+  }
+  return accepting_[state] != 0;
+}
+
+/**
+ * @brief Avanza desde state consumiendo input, hasta el final o hasta kDead.
+ */
+int Dfa::Advance(int state, std::string_view input, std::size_t& steps) const {
+  const std::size_t num_classes = static_cast<std::size_t>(num_classes_);
+  steps = 0;
+  while (steps < input.size()) {
+    int class_id = class_of_[static_cast<unsigned char>(input[steps++])];
+    if (class_id == Automaton::kNoClass) return kDead;  // fuera del alfabeto
+    state = next_[static_cast<std::size_t>(state) * num_classes + class_id];
+    if (state == kDead) return kDead;
+  }
+  return state;
+}
+
+/**
+ * @brief Escribe el DFA en formato binario .dfa.
+ */
+bool Dfa::WriteFile(const std::string& filename, std::string& err_msg) const {
+  std::string buffer(kDfaMagic, sizeof(kDfaMagic));
+  AppendRaw(buffer, kDfaVersion);
+  AppendRaw(buffer, static_cast<std::int32_t>(num_states_));
+  AppendRaw(buffer, static_cast<std::int32_t>(num_classes_));
+  AppendRaw(buffer, static_cast<std::int32_t>(start_));
+  for (int class_id : class_of_) AppendRaw(buffer, static_cast<std::int32_t>(class_id));
+  buffer.append(accepting_.begin(), accepting_.end());
+  for (int target : next_) AppendRaw(buffer, static_cast<std::int32_t>(target));
+  AppendRaw(buffer, Fnv1a64(buffer.data(), buffer.size()));
+
+  std::ofstream ofs(filename, std::ios::binary);
+  if (!ofs) {
+    err_msg = "No se puede crear fichero: " + filename;
+    return false;
+  }
+  ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  if (!ofs) {
+    err_msg = "Error escribiendo fichero: " + filename;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Lee un DFA en formato binario .dfa, validando su contenido.
+ */
+bool Dfa::ReadFile(const std::string& filename, std::string& err_msg) {
+  std::ifstream ifs(filename, std::ios::binary);
+  if (!ifs) {
+    err_msg = "No se puede abrir fichero: " + filename;
+    return false;
+  }
+  std::string buffer((std::istreambuf_iterator<char>(ifs)),
+                     std::istreambuf_iterator<char>());
+
+  // Cabecera, versión y suma de comprobación
+  if (buffer.size() < sizeof(kDfaMagic) + sizeof(std::uint64_t) ||
+      std::memcmp(buffer.data(), kDfaMagic, sizeof(kDfaMagic)) != 0) {
+    err_msg = "El fichero no tiene formato .dfa: " + filename;
+    return false;
+  }
+  std::size_t body = buffer.size() - sizeof(std::uint64_t);
+  std::uint64_t checksum;
+  std::memcpy(&checksum, buffer.data() + body, sizeof(checksum));
+  if (checksum != Fnv1a64(buffer.data(), body)) {
+    err_msg = "Suma de comprobación incorrecta en fichero: " + filename;
+    return false;
+  }
+  buffer.resize(body);
+
+  std::size_t pos = sizeof(kDfaMagic);
+  std::uint32_t version;
+  std::int32_t num_states, num_classes, start;
+  if (!ReadRaw(buffer, pos, version) || version != kDfaVersion) {
+    err_msg = "Versión de formato .dfa no soportada.";
+    return false;
+  }
+  if (!ReadRaw(buffer, pos, num_states) || !ReadRaw(buffer, pos, num_classes) ||
+      !ReadRaw(buffer, pos, start) || num_states < 1 || num_classes < 0 ||
+      num_classes > 256 || start < 0 || start >= num_states) {
+    err_msg = "Cabecera .dfa inválida.";
+    return false;
+  }
+  std::size_t cells = static_cast<std::size_t>(num_states) * num_classes;
+  if (buffer.size() - pos != 256 * sizeof(std::int32_t) + static_cast<std::size_t>(num_states) +
+                                cells * sizeof(std::int32_t)) {
+    err_msg = "Tamaño de fichero .dfa incorrecto.";
+    return false;
+  }
+
+  Automaton::ClassTable class_of;
+  for (int& class_id : class_of) {
+    std::int32_t value = 0;
+    ReadRaw(buffer, pos, value);
+    if (value < Automaton::kNoClass || value >= num_classes) {
+      err_msg = "Clase de símbolo fuera de rango en fichero .dfa.";
+      return false;
+    }
+    class_id = value;
+  }
+  std::vector<std::uint8_t> accepting(buffer.begin() + pos,
+                                      buffer.begin() + pos + num_states);
+  pos += num_states;
+  std::vector<int> next(cells);
+  for (std::size_t i = 0; i < cells; ++i) {
+    std::int32_t target = 0;
+    ReadRaw(buffer, pos, target);
+    if (target < kDead || target >= num_states) {
+      err_msg = "Transición fuera de rango en fichero .dfa.";
+      return false;
+    }
+    next[i] = target;
+  }
+  Assign(class_of, num_classes, num_states, start, std::move(next), std::move(accepting));
+  return true;
+}
+
+// Getters
+int Dfa::GetNumStates() const {
+  return num_states_;
+}
+
+int Dfa::GetNumClasses() const {
+  return num_classes_;
+}
+
+int Dfa::GetStartState() const {
+  return start_;
+}
+
+bool Dfa::IsAccepting(int state) const {
+  return accepting_[state] != 0;
+}
+
+int Dfa::GetNext(int state, int class_id) const {
+  return next_[static_cast<std::size_t>(state) * num_classes_ + class_id];
+}
+
+int Dfa::GetClass(Automaton::Symbol symbol) const {
+  return class_of_[static_cast<unsigned char>(symbol)];
+}
+
+const Automaton::ClassTable& Dfa::GetClassTable() const {
+  return class_of_;
+}
+
+}
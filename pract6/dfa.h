@@ -0,0 +1,139 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: dfa.h: interfaz de la clase Dfa.
+ *    Contiene la definición de un autómata finito determinista con tabla de
+ *    transiciones densa, su construcción a partir de un NFA (construcción de
+ *    subconjuntos) y su serialización a fichero .dfa.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Tabla indexada por clase de símbolo
+ *    16/10/2026 - Simulate recibe std::string_view (sin copias de la cadena)
+ *    16/10/2026 - Método Advance (simulación desde un estado cualquiera)
+*/
+
+/**
+ * @file dfa.h
+ * @brief Interfaz del DFA con tabla densa.
+ *
+ * El DFA se obtiene una sola vez (por ejemplo con la herramienta
+ * --determinize) y se guarda en un fichero binario .dfa; después se carga y se
+ * simula con una consulta a la tabla por símbolo, sin volver a determinizar.
+ */
+
+#ifndef P06_AUTOMATON_DFA_H_
+#define P06_AUTOMATON_DFA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "automata.h"
+
+namespace p06 {
+
+/**
+ * @brief Autómata finito determinista con tabla [estado][clase de símbolo].
+ *
+ * Las clases y la tabla carácter -> clase son las del Automaton de origen,
+ * así que el DFA acepta exactamente las mismas cadenas que
+ * AutomatonSimulator::Simulate sobre el NFA y cada fila tiene solo tantas
+ * columnas como clases. Las transiciones ausentes valen kDead (DFA parcial,
+ * sin estado sumidero).
+ */
+class Dfa {
+ public:
+  static constexpr int kDead = -1; // Transición al conjunto vacío
+  static constexpr std::size_t kDefaultMaxStates = 1000000; // Límite por defecto
+
+  /**
+   * @brief Construye un DFA vacío (sin estados).
+   */
+  Dfa();
+
+  /**
+   * @brief Determiniza un NFA mediante construcción de subconjuntos.
+   *
+   * @param nfa Autómata congelado
+   * @param max_states Número máximo de estados del DFA
+   * @param dfa Salida: DFA equivalente
+   * @param err_msg En caso de error (límite superado) se escribe aquí una descripción
+   * @return true si la construcción terminó dentro del límite
+   */
+  static bool Determinize(const Automaton& nfa, std::size_t max_states, Dfa& dfa,
+                          std::string& err_msg);
+
+  /**
+   * @brief Sustituye el contenido del DFA.
+   *
+   * @param class_of Tabla carácter -> clase (Automaton::kNoClass si no es válido)
+   * @param num_classes Número de clases
+   * @param num_states Número de estados
+   * @param start Estado inicial
+   * @param next Tabla de transiciones (num_states * num_classes entradas)
+   * @param accepting Aceptación de cada estado (num_states entradas)
+   */
+  void Assign(const Automaton::ClassTable& class_of, int num_classes, int num_states,
+              int start, std::vector<int> next, std::vector<std::uint8_t> accepting);
+
+  /**
+   * @brief Simula la cadena dada sobre el DFA.
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @return true si la cadena es aceptada, false si es rechazada
+   */
+  bool Simulate(std::string_view input) const;
+
+  /**
+   * @brief Avanza desde un estado cualquiera consumiendo input.
+   *
+   * Se detiene en el primer símbolo fuera del alfabeto o sin transición.
+   *
+   * @param state Estado de partida
+   * @param input Símbolos a consumir
+   * @param steps Salida: símbolos consumidos (incluido el que lleva a kDead)
+   * @return Estado alcanzado, o kDead si la cadena queda rechazada
+   */
+  int Advance(int state, std::string_view input, std::size_t& steps) const;
+
+  /**
+   * @name Serialización binaria (.dfa)
+   * @return true en caso de éxito; si no, err_msg describe el problema
+   */
+  bool WriteFile(const std::string& filename, std::string& err_msg) const;
+  bool ReadFile(const std::string& filename, std::string& err_msg);
+
+  /**
+   * @name Getters
+   */
+  int GetNumStates() const; // Número de estados
+  int GetNumClasses() const; // Número de clases de símbolos
+  int GetStartState() const; // Estado inicial
+  bool IsAccepting(int state) const; // true si el estado es de aceptación
+  int GetNext(int state, int class_id) const; // Destino o kDead
+  int GetClass(Automaton::Symbol symbol) const; // Clase o Automaton::kNoClass
+  const Automaton::ClassTable& GetClassTable() const; // Tabla carácter -> clase
+
+ private:
+  Automaton::ClassTable class_of_; // Carácter -> clase (kNoClass si no es válido)
+  int num_classes_; // Columnas de la tabla
+  int num_states_; // Número de estados
+  int start_; // Estado inicial
+  std::vector<int> next_; // Tabla [estado * num_classes + clase]
+  std::vector<std::uint8_t> accepting_; // accepting_[q] != 0 si q es de aceptación
+};
+
+}
+
+#endif
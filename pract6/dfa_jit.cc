@@ -0,0 +1,306 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: dfa_jit.cc: implementación de la clase DfaJit.
+ *    Contiene el ensamblador mínimo x86-64 y la generación del código de cada estado.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    Intel 64 and IA-32 Architectures Software Developer's Manual, Vol. 2
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file dfa_jit.cc
+ * @brief Implementación del compilador JIT de DFAs.
+ *
+ * Registros del código generado: rdi = siguiente byte, rsi = fin de la
+ * cadena, eax = byte leído, rcx/rdx = auxiliares. Todos son de uso libre en
+ * System V, así que no hace falta prólogo ni epílogo.
+ */
+
+#include "dfa_jit.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+#if defined(__x86_64__) && defined(__unix__)
+#include <sys/mman.h>
+#define P06_DFA_JIT_X86_64 1
+#endif
+
+namespace p06 {
+
+#ifdef P06_DFA_JIT_X86_64
+
+/**
+ * @brief Ensamblador mínimo: bytes de código, etiquetas y saltos por resolver.
+ *
+ * Los desplazamientos de 32 bits se escriben a 0 y se anotan como
+ * referencias (posición, etiqueta, base); Resolve escribe después
+ * offset(etiqueta) - base en cada una.
+ */
+class Assembler {
+ public:
+  int NewLabel() {
+    labels_.push_back(kUnbound);
+    return static_cast<int>(labels_.size()) - 1;
+  }
+  void Bind(int label) { labels_[label] = static_cast<std::int64_t>(code_.size()); }
+
+  void Bytes(std::initializer_list<std::uint8_t> bytes) {
+    code_.insert(code_.end(), bytes.begin(), bytes.end());
+  }
+  void Imm32(std::int32_t value) {
+    std::uint8_t bytes[4];
+    std::memcpy(bytes, &value, 4);
+    code_.insert(code_.end(), bytes, bytes + 4);
+  }
+  // Desplazamiento relativo al final del propio campo (saltos y lea rip)
+  void Rel32(int label) { Reference(label, code_.size() + 4); }
+  // Entrada de tabla de saltos: relativa al inicio de la tabla
+  void Entry(int label, std::size_t table) { Reference(label, table); }
+
+  void Align(std::size_t alignment) {
+    while (code_.size() % alignment != 0) code_.push_back(0xCC);  // int3
+  }
+
+  std::size_t GetSize() const { return code_.size(); }
+  const std::vector<std::uint8_t>& GetCode() const { return code_; }
+
+  void Resolve() {
+    for (const Fixup& fixup : fixups_) {
+      auto value = static_cast<std::int32_t>(labels_[fixup.label] -
+                                             static_cast<std::int64_t>(fixup.base));
+      std::memcpy(&code_[fixup.position], &value, 4);
+    }
+  }
+
+ private:
+  static constexpr std::int64_t kUnbound = -1;
+
+  struct Fixup {
+    std::size_t position; // Posición del campo de 32 bits
+    int label; // Etiqueta destino
+    std::size_t base; // Origen del desplazamiento
+  };
+
+  void Reference(int label, std::size_t base) {
+    fixups_.push_back(Fixup{code_.size(), label, base});
+    Imm32(0);
+  }
+
+  std::vector<std::uint8_t> code_;
+  std::vector<std::int64_t> labels_; // Offset de cada etiqueta
+  std::vector<Fixup> fixups_;
+};
+
+// Por encima de este número de rangos con destino se usa tabla de saltos
+static constexpr int kMaxCompareRanges = 4;
+
+/**
+ * @brief Genera el código del DFA en assembler.
+ *
+ * Estado q:
+ *    cmp rdi, rsi ; je aceptar/rechazar
+ *    movzx eax, byte [rdi] ; inc rdi
+ *  y después, por cada rango [lo, hi] de bytes con el mismo destino d:
+ *    cmp eax, lo ; je d                       (lo == hi)
+ *    lea ecx, [rax - lo] ; cmp ecx, hi - lo ; jbe d
+ *  terminando en jmp rechazar; o bien, con muchos rangos:
+ *    lea rcx, [tabla] ; movsxd rdx, [rcx + rax*4] ; add rdx, rcx ; jmp rdx
+ *  Las tablas (destino - inicio de tabla, 32 bits) van tras todo el código.
+ *
+ * @return false si el código supera DfaJit::kMaxCodeBytes
+ */
+static bool Generate(const Dfa& dfa, Assembler& as) {
+  const int num_states = dfa.GetNumStates();
+  const Automaton::ClassTable& class_of = dfa.GetClassTable();
+
+  std::vector<int> state_label(num_states);
+  for (int q = 0; q < num_states; ++q) state_label[q] = as.NewLabel();
+  const int accept = as.NewLabel();
+  const int reject = as.NewLabel();
+
+  struct PendingTable {
+    int label;
+    std::vector<int> targets; // Etiqueta destino de cada byte
+  };
+  std::vector<PendingTable> tables;
+
+  // Punto de entrada: el estado inicial
+  if (num_states == 0) {
+    as.Bytes({0xE9});  // jmp rechazar
+    as.Rel32(reject);
+  } else if (dfa.GetStartState() != 0) {
+    as.Bytes({0xE9});  // jmp inicial
+    as.Rel32(state_label[dfa.GetStartState()]);
+  }
+
+  std::vector<int> target(256);
+  for (int q = 0; q < num_states; ++q) {
+    // Cada tabla pendiente ocupará 1 KB al final
+    if (as.GetSize() + tables.size() * 1024 > DfaJit::kMaxCodeBytes) return false;
+    as.Align(16);
+    as.Bind(state_label[q]);
+    as.Bytes({0x48, 0x39, 0xF7});  // cmp rdi, rsi
+    as.Bytes({0x0F, 0x84});  // je
+    as.Rel32(dfa.IsAccepting(q) ? accept : reject);
+    as.Bytes({0x0F, 0xB6, 0x07});  // movzx eax, byte [rdi]
+    as.Bytes({0x48, 0xFF, 0xC7});  // inc rdi
+
+    // Destino de cada byte (-1 = sin transición) y número de rangos
+    int num_ranges = 0;
+    for (int byte = 0; byte < 256; ++byte) {
+      int class_id = class_of[byte];
+      int next = class_id == Automaton::kNoClass ? Dfa::kDead : dfa.GetNext(q, class_id);
+      target[byte] = next == Dfa::kDead ? -1 : next;
+      if (target[byte] >= 0 && (byte == 0 || target[byte - 1] != target[byte])) ++num_ranges;
+    }
+
+    if (num_ranges > kMaxCompareRanges) {
+      PendingTable table{as.NewLabel(), std::vector<int>(256)};
+      for (int byte = 0; byte < 256; ++byte) {
+        table.targets[byte] = target[byte] < 0 ? reject : state_label[target[byte]];
+      }
+      as.Bytes({0x48, 0x8D, 0x0D});  // lea rcx, [rip + tabla]
+      as.Rel32(table.label);
+      as.Bytes({0x48, 0x63, 0x14, 0x81});  // movsxd rdx, dword [rcx + rax*4]
+      as.Bytes({0x48, 0x01, 0xCA});  // add rdx, rcx
+      as.Bytes({0xFF, 0xE2});  // jmp rdx
+      tables.push_back(std::move(table));
+      continue;
+    }
+
+    for (int lo = 0; lo < 256;) {
+      int hi = lo;
+      while (hi + 1 < 256 && target[hi + 1] == target[lo]) ++hi;
+      if (target[lo] >= 0) {
+        if (lo == hi) {
+          as.Bytes({0x3D});  // cmp eax, lo
+          as.Imm32(lo);
+          as.Bytes({0x0F, 0x84});  // je
+        } else {
+          as.Bytes({0x8D, 0x88});  // lea ecx, [rax - lo]
+          as.Imm32(-lo);
+          as.Bytes({0x81, 0xF9});  // cmp ecx, hi - lo
+          as.Imm32(hi - lo);
+          as.Bytes({0x0F, 0x86});  // jbe
+        }
+        as.Rel32(state_label[target[lo]]);
+      }
+      lo = hi + 1;
+    }
+    as.Bytes({0xE9});  // jmp rechazar
+    as.Rel32(reject);
+  }
+
+  as.Align(16);
+  as.Bind(accept);
+  as.Bytes({0xB8, 0x01, 0x00, 0x00, 0x00, 0xC3});  // mov eax, 1 ; ret
+  as.Bind(reject);
+  as.Bytes({0x31, 0xC0, 0xC3});  // xor eax, eax ; ret
+
+  for (const PendingTable& table : tables) {
+    as.Align(4);
+    as.Bind(table.label);
+    std::size_t base = as.GetSize();
+    for (int label : table.targets) as.Entry(label, base);
+  }
+  as.Resolve();
+  return as.GetSize() <= DfaJit::kMaxCodeBytes;
+}
+
+#endif
+
+/**
+ * @brief Constructor: genera el código y lo instala en una región ejecutable.
+ *
+ * Pasos:
+ *  -Generación en un buffer (Generate) y resolución de saltos.
+ *  -mmap de lectura/escritura, copia y mprotect a lectura/ejecución (la
+ *   región nunca es escribible y ejecutable a la vez).
+ *  -Si algún paso no es posible queda match_ a nullptr y se interpreta.
+ */
+DfaJit::DfaJit(const Dfa& dfa)
+    : dfa_(dfa), region_(nullptr), region_size_(0), code_size_(0), match_(nullptr) {
+  const char* env = std::getenv("P06_JIT");
+  if (env != nullptr && std::string(env) == "off") {
+    fallback_reason_ = "desactivado con P06_JIT=off";
+    return;
+  }
+#ifdef P06_DFA_JIT_X86_64
+  Assembler as;
+  if (!Generate(dfa, as)) {
+    fallback_reason_ = "el código superaría el límite de tamaño";
+    return;
+  }
+  code_size_ = as.GetSize();
+  const std::size_t page = 4096;
+  region_size_ = (code_size_ + page - 1) / page * page;
+  void* region = mmap(nullptr, region_size_, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (region == MAP_FAILED) {
+    fallback_reason_ = "mmap no disponible";
+    code_size_ = region_size_ = 0;
+    return;
+  }
+  std::memcpy(region, as.GetCode().data(), code_size_);
+  if (mprotect(region, region_size_, PROT_READ | PROT_EXEC) != 0) {
+    munmap(region, region_size_);
+    fallback_reason_ = "la región no puede hacerse ejecutable";
+    code_size_ = region_size_ = 0;
+    return;
+  }
+  region_ = region;
+  match_ = reinterpret_cast<MatchFn>(region);
+#else
+  fallback_reason_ = "arquitectura sin soporte (solo x86-64)";
+#endif
+}
+
+/**
+ * @brief Destructor: libera la región de código.
+ */
+DfaJit::~DfaJit() {
+#ifdef P06_DFA_JIT_X86_64
+  if (region_ != nullptr) munmap(region_, region_size_);
+#endif
+}
+
+/**
+ * @brief Simula la cadena con el código generado o, sin JIT, con el DFA.
+ *
+ * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+ * @return true si la cadena es aceptada, false si es rechazada
+ */
+bool DfaJit::Simulate(std::string_view input) const {
+  if (match_ == nullptr) return dfa_.Simulate(input);
+  const auto* p = reinterpret_cast<const unsigned char*>(input.data());
+  return match_(p, p + input.size());
+}
+
+bool DfaJit::IsCompiled() const {
+  return match_ != nullptr;
+}
+
+std::size_t DfaJit::GetCodeSize() const {
+  return code_size_;
+}
+
+const std::string& DfaJit::GetFallbackReason() const {
+  return fallback_reason_;
+}
+
+}
@@ -0,0 +1,95 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: dfa_jit.h: interfaz de la clase DfaJit.
+ *    Contiene la traducción de un DFA a código máquina x86-64 en tiempo de
+ *    ejecución, con el intérprete de tablas como alternativa.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    Intel 64 and IA-32 Architectures Software Developer's Manual, Vol. 2
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file dfa_jit.h
+ * @brief Interfaz del compilador JIT de DFAs.
+ *
+ * Es el equivalente en proceso de --emit-cpp para autómatas que solo se
+ * conocen en tiempo de ejecución: cada estado es un bloque básico de código
+ * nativo y cada transición un salto, sin acceso a la tabla del DFA.
+ */
+
+#ifndef P06_SIMULATOR_DFA_JIT_H_
+#define P06_SIMULATOR_DFA_JIT_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "dfa.h"
+
+namespace p06 {
+
+/**
+ * @brief Simulador de un Dfa mediante código x86-64 generado al construirlo.
+ *
+ * Cada estado comprueba el fin de la cadena, lee un byte y salta al destino:
+ * con una cadena de comparaciones por rangos de bytes si tiene pocos rangos
+ * con destino, o con una tabla de saltos de 256 entradas si no. El código
+ * se escribe en una región mmap que después pasa a ser solo de lectura y
+ * ejecución.
+ *
+ * Si el JIT no está disponible (otra arquitectura, mmap/mprotect
+ * denegados, código demasiado grande o P06_JIT=off en el entorno) se usa
+ * Dfa::Simulate. Simulate es const y puede llamarse desde varios hilos.
+ */
+class DfaJit {
+ public:
+  // Tamaño máximo del código generado; por encima se usa el intérprete
+  static constexpr std::size_t kMaxCodeBytes = std::size_t{256} << 20;
+
+  /**
+   * @brief Genera el código del DFA (o prepara la alternativa).
+   * @param dfa DFA (debe sobrevivir al simulador)
+   */
+  explicit DfaJit(const Dfa& dfa);
+  ~DfaJit();
+
+  DfaJit(const DfaJit&) = delete;
+  DfaJit& operator=(const DfaJit&) = delete;
+
+  /**
+   * @brief Simula la cadena dada sobre el DFA.
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @return true si la cadena es aceptada, false si es rechazada
+   */
+  bool Simulate(std::string_view input) const;
+
+  bool IsCompiled() const; // true si se ejecuta código nativo
+  std::size_t GetCodeSize() const; // Bytes de código generado (0 sin JIT)
+  const std::string& GetFallbackReason() const; // Por qué no hay JIT ("" si lo hay)
+
+ private:
+  // Firma del código generado (System V: rdi = p, rsi = end)
+  using MatchFn = bool (*)(const unsigned char* p, const unsigned char* end);
+
+  const Dfa& dfa_; // DFA (intérprete de tablas si no hay JIT)
+  void* region_; // Región mmap con el código (nullptr sin JIT)
+  std::size_t region_size_; // Tamaño de la región
+  std::size_t code_size_; // Bytes de código y tablas generados
+  MatchFn match_; // Punto de entrada (nullptr sin JIT)
+  std::string fallback_reason_; // Motivo de usar el intérprete
+};
+
+}
+
+#endif
@@ -0,0 +1,296 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: dfa_minimizer.cc: implementación de la clase DfaMinimizer.
+ *    Contiene el algoritmo de minimización de Valmari-Lehtinen.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    A. Valmari, "Fast brief practical DFA minimization", Inf. Process. Lett., 2012
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file dfa_minimizer.cc
+ * @brief Implementación de la minimización por refinamiento de particiones.
+ *
+ * Se mantienen dos particiones refinables: bloques de estados y "cuerdas" de
+ * transiciones (inicialmente, una por clase de símbolo). Cada cuerda divide los
+ * bloques según el origen de sus transiciones y cada bloque nuevo divide las
+ * cuerdas según el destino, hasta que ninguna partición cambia.
+ */
+
+#include "dfa_minimizer.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace p06 {
+
+/**
+ * @brief Partición refinable de {0, ..., n-1} (Valmari-Lehtinen).
+ *
+ * elements guarda los elementos agrupados por conjunto; el conjunto s ocupa
+ * [first[s], past[s]). Los elementos marcados de s se mueven al principio de
+ * su rango y split() los separa en un conjunto nuevo (el más pequeño de las
+ * dos mitades conserva el número nuevo).
+ */
+struct RefinablePartition {
+  int num_sets = 0;
+  std::vector<int> elements; // Elementos agrupados por conjunto
+  std::vector<int> location; // Posición de cada elemento en elements
+  std::vector<int> set_of; // Conjunto de cada elemento
+  std::vector<int> first; // Inicio del rango de cada conjunto
+  std::vector<int> past; // Fin (exclusivo) del rango de cada conjunto
+
+  void Init(int n) {
+    num_sets = n > 0 ? 1 : 0;
+    elements.resize(n);
+    location.resize(n);
+    set_of.assign(n, 0);
+    first.assign(n + 1, 0);
+    past.assign(n + 1, 0);
+    for (int i = 0; i < n; ++i) elements[i] = location[i] = i;
+    if (num_sets) past[0] = n;
+  }
+
+  // Marca un elemento: lo mueve a la zona marcada de su conjunto
+  void Mark(int e, std::vector<int>& marked, std::vector<int>& touched) {
+    int s = set_of[e];
+    int i = location[e];
+    int j = first[s] + marked[s];
+    elements[i] = elements[j];
+    location[elements[i]] = i;
+    elements[j] = e;
+    location[e] = j;
+    if (marked[s]++ == 0) touched.push_back(s);
+  }
+
+  // Divide los conjuntos tocados en parte marcada y parte no marcada
+  void Split(std::vector<int>& marked, std::vector<int>& touched) {
+    while (!touched.empty()) {
+      int s = touched.back();
+      touched.pop_back();
+      int j = first[s] + marked[s];
+      if (j == past[s]) {
+        // Todo el conjunto marcado: no hay división
+        marked[s] = 0;
+        continue;
+      }
+      if (marked[s] <= past[s] - j) {
+        first[num_sets] = first[s];
+        past[num_sets] = first[s] = j;
+      } else {
+        past[num_sets] = past[s];
+        first[num_sets] = past[s] = j;
+      }
+      for (int i = first[num_sets]; i < past[num_sets]; ++i) set_of[elements[i]] = num_sets;
+      marked[s] = marked[num_sets] = 0;
+      ++num_sets;
+    }
+  }
+};
+
+/**
+ * @brief Estado completo del algoritmo (arrays de transiciones y particiones).
+ */
+struct Minimization {
+  int num_states = 0;
+  int num_transitions = 0;
+  std::vector<int> tail, label, head; // Transición t: tail -label-> head
+  RefinablePartition blocks; // Partición de estados
+  RefinablePartition cords; // Partición de transiciones
+  std::vector<int> adjacent; // Transiciones agrupadas por estado
+  std::vector<int> adjacent_first; // Inicio del grupo de cada estado
+  int reached = 0; // Número de estados alcanzados en el recorrido actual
+
+  // Agrupa las transiciones por el estado key[t] (counting sort)
+  void MakeAdjacent(const std::vector<int>& key) {
+    adjacent_first.assign(num_states + 1, 0);
+    for (int t = 0; t < num_transitions; ++t) ++adjacent_first[key[t]];
+    for (int q = 0; q < num_states; ++q) adjacent_first[q + 1] += adjacent_first[q];
+    for (int t = num_transitions; t--;) adjacent[--adjacent_first[key[t]]] = t;
+  }
+
+  // Marca q como alcanzado moviéndolo a la zona [0, reached) del bloque 0
+  void Reach(int q) {
+    int i = blocks.location[q];
+    if (i >= reached) {
+      blocks.elements[i] = blocks.elements[reached];
+      blocks.location[blocks.elements[i]] = i;
+      blocks.elements[reached] = q;
+      blocks.location[q] = reached++;
+    }
+  }
+
+  // Recorre desde los estados alcanzados siguiendo from -> to y descarta el
+  // resto de estados y sus transiciones
+  void RemoveUnreachable(std::vector<int>& from, std::vector<int>& to) {
+    MakeAdjacent(from);
+    for (int i = 0; i < reached; ++i) {
+      int q = blocks.elements[i];
+      for (int j = adjacent_first[q]; j < adjacent_first[q + 1]; ++j) Reach(to[adjacent[j]]);
+    }
+    int kept = 0;
+    for (int t = 0; t < num_transitions; ++t) {
+      if (blocks.location[from[t]] < reached) {
+        head[kept] = head[t];
+        label[kept] = label[t];
+        tail[kept] = tail[t];
+        ++kept;
+      }
+    }
+    num_transitions = kept;
+    blocks.past[0] = reached;
+    reached = 0;
+  }
+};
+
+/**
+ * @brief Minimiza el DFA (Valmari-Lehtinen) y renumera el resultado.
+ */
+Dfa DfaMinimizer::Minimize(const Dfa& dfa) {
+  const int num_classes = dfa.GetNumClasses();
+
+  Minimization m;
+  m.num_states = dfa.GetNumStates();
+  for (int q = 0; q < m.num_states; ++q) {
+    for (int a = 0; a < num_classes; ++a) {
+      int target = dfa.GetNext(q, a);
+      if (target == Dfa::kDead) continue;
+      m.tail.push_back(q);
+      m.label.push_back(a);
+      m.head.push_back(target);
+    }
+  }
+  m.num_transitions = static_cast<int>(m.tail.size());
+  m.adjacent.resize(m.num_transitions);
+
+  // Estados alcanzables desde el inicial y, de ellos, los que llevan a aceptación
+  m.blocks.Init(m.num_states);
+  if (m.num_states > 0) {
+    m.Reach(dfa.GetStartState());
+    m.RemoveUnreachable(m.tail, m.head);
+    for (int q = 0; q < m.num_states; ++q) {
+      if (dfa.IsAccepting(q) && m.blocks.location[q] < m.blocks.past[0]) m.Reach(q);
+    }
+  }
+  const int num_final = m.reached;
+  m.RemoveUnreachable(m.head, m.tail);
+
+  // Lenguaje vacío: un único estado de rechazo sin transiciones
+  if (m.num_states == 0 ||
+      m.blocks.location[dfa.GetStartState()] >= m.blocks.past[0]) {
+    Dfa empty;
+    empty.Assign(dfa.GetClassTable(), num_classes, 1, 0,
+                 std::vector<int>(num_classes, Dfa::kDead), std::vector<std::uint8_t>(1, 0));
+    return empty;
+  }
+
+  // Partición inicial: finales / no finales
+  std::vector<int> marked(m.num_transitions + 1, 0);
+  std::vector<int> touched;
+  touched.reserve(m.num_transitions + 1);
+  marked[0] = num_final;
+  if (num_final) {
+    touched.push_back(0);
+    m.blocks.Split(marked, touched);
+  }
+
+  // Partición inicial de transiciones: una cuerda por clase (counting sort)
+  m.cords.Init(m.num_transitions);
+  if (m.num_transitions) {
+    std::vector<int> count(num_classes + 1, 0);
+    for (int t = 0; t < m.num_transitions; ++t) ++count[m.label[t] + 1];
+    for (int a = 0; a < num_classes; ++a) count[a + 1] += count[a];
+    for (int t = 0; t < m.num_transitions; ++t) m.cords.elements[count[m.label[t]]++] = t;
+    m.cords.num_sets = 0;
+    marked[0] = 0;
+    int a = m.label[m.cords.elements[0]];
+    for (int i = 0; i < m.num_transitions; ++i) {
+      int t = m.cords.elements[i];
+      if (m.label[t] != a) {
+        a = m.label[t];
+        m.cords.past[m.cords.num_sets++] = i;
+        m.cords.first[m.cords.num_sets] = i;
+        marked[m.cords.num_sets] = 0;
+      }
+      m.cords.set_of[t] = m.cords.num_sets;
+      m.cords.location[t] = i;
+    }
+    m.cords.past[m.cords.num_sets++] = m.num_transitions;
+  }
+
+  // Refinamiento alterno de bloques y cuerdas
+  m.MakeAdjacent(m.head);
+  int b = 1;
+  int c = 0;
+  while (c < m.cords.num_sets) {
+    for (int i = m.cords.first[c]; i < m.cords.past[c]; ++i) {
+      m.blocks.Mark(m.tail[m.cords.elements[i]], marked, touched);
+    }
+    m.blocks.Split(marked, touched);
+    ++c;
+    while (b < m.blocks.num_sets) {
+      for (int i = m.blocks.first[b]; i < m.blocks.past[b]; ++i) {
+        int q = m.blocks.elements[i];
+        for (int j = m.adjacent_first[q]; j < m.adjacent_first[q + 1]; ++j) {
+          m.cords.Mark(m.adjacent[j], marked, touched);
+        }
+      }
+      m.cords.Split(marked, touched);
+      ++b;
+    }
+  }
+
+  // Numeración en anchura desde el bloque inicial
+  const int num_blocks = m.blocks.num_sets;
+  std::vector<int> block_next(static_cast<std::size_t>(num_blocks) * num_classes, Dfa::kDead);
+  for (int t = 0; t < m.num_transitions; ++t) {
+    block_next[static_cast<std::size_t>(m.blocks.set_of[m.tail[t]]) * num_classes +
+               m.label[t]] = m.blocks.set_of[m.head[t]];
+  }
+  std::vector<int> new_id(num_blocks, -1);
+  std::vector<int> order;
+  order.reserve(num_blocks);
+  int start_block = m.blocks.set_of[dfa.GetStartState()];
+  new_id[start_block] = 0;
+  order.push_back(start_block);
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    for (int a = 0; a < num_classes; ++a) {
+      int target = block_next[static_cast<std::size_t>(order[i]) * num_classes + a];
+      if (target != Dfa::kDead && new_id[target] < 0) {
+        new_id[target] = static_cast<int>(order.size());
+        order.push_back(target);
+      }
+    }
+  }
+
+  std::vector<int> next(static_cast<std::size_t>(num_blocks) * num_classes, Dfa::kDead);
+  std::vector<std::uint8_t> accepting(num_blocks, 0);
+  for (int i = 0; i < num_blocks; ++i) {
+    int block = order[i];
+    // Los estados finales ocupan las posiciones [0, num_final) de elements
+    accepting[i] = m.blocks.first[block] < num_final ? 1 : 0;
+    for (int a = 0; a < num_classes; ++a) {
+      int target = block_next[static_cast<std::size_t>(block) * num_classes + a];
+      if (target != Dfa::kDead) next[static_cast<std::size_t>(i) * num_classes + a] = new_id[target];
+    }
+  }
+
+  Dfa minimal;
+  minimal.Assign(dfa.GetClassTable(), num_classes, num_blocks, 0, std::move(next),
+                 std::move(accepting));
+  return minimal;
+}
+
+}
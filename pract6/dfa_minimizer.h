@@ -0,0 +1,58 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: dfa_minimizer.h: interfaz de la clase DfaMinimizer.
+ *    Contiene la minimización de DFAs por refinamiento de particiones
+ *    (algoritmo de Valmari-Lehtinen, O(m log n)).
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    A. Valmari, "Fast brief practical DFA minimization", Inf. Process. Lett., 2012
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file dfa_minimizer.h
+ * @brief Interfaz del minimizador de DFAs.
+ *
+ * Etapa opcional tras la determinización: el tamaño de la tabla decide si
+ * cabe en caché, así que conviene simular con el DFA mínimo.
+ */
+
+#ifndef P06_AUTOMATON_DFA_MINIMIZER_H_
+#define P06_AUTOMATON_DFA_MINIMIZER_H_
+
+#include "dfa.h"
+
+namespace p06 {
+
+/**
+ * @brief Minimizador de DFAs parciales (Valmari-Lehtinen).
+ *
+ * Trabaja solo con arrays (particiones refinables de estados y de
+ * transiciones), sin recursión ni conjuntos por bloque, de modo que admite
+ * DFAs de millones de estados. Elimina los estados inalcanzables y los que
+ * no llevan a aceptación, y numera el resultado en anchura desde el estado
+ * inicial (que queda como estado 0).
+ */
+class DfaMinimizer {
+ public:
+  /**
+   * @brief Calcula el DFA mínimo equivalente.
+   * @param dfa DFA de entrada
+   * @return DFA mínimo (un único estado de rechazo si el lenguaje es vacío)
+   */
+  static Dfa Minimize(const Dfa& dfa);
+};
+
+}
+
+#endif
@@ -0,0 +1,246 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: epsilon_closure.cc: implementación de la clase EpsilonClosureTable.
+ *    Contiene el cálculo de componentes fuertemente conexas y de los cierres
+ *    por & de cada estado.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    R. Tarjan, "Depth-first search and linear graph algorithms", SIAM J. Comput., 1972
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - AppendClosure con marcas por generación
+ *    16/10/2026 - AppendClosure sobre SimulatorScratch (pila del DFS sin reservas)
+ *    16/10/2026 - Generación y marcas en locales dentro de AppendClosure
+ *    16/10/2026 - IsTrivial también con la tabla incompleta
+*/
+
+/**
+ * @file epsilon_closure.cc
+ * @brief Implementación de la tabla de cierres por &.
+ */
+
+#include "epsilon_closure.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace p06 {
+
+/**
+ * @brief Constructor: condensa el grafo de & y calcula el cierre de cada componente.
+ *
+ * Tarjan numera las componentes de forma que cada una aparece después de
+ * todas las que alcanza, así que al recorrerlas en orden creciente los
+ * cierres de las sucesoras ya están calculados.
+ */
+EpsilonClosureTable::EpsilonClosureTable(const Automaton& automaton,
+                                         std::size_t max_entries)
+    : automaton_(automaton), complete_(true), num_components_(0) {
+  const int num_states = automaton.GetNumStates();
+  ComputeComponents(automaton);
+
+  // Estados de cada componente (counting sort por componente)
+  std::vector<std::uint32_t> member_offsets(num_components_ + 1, 0);
+  for (int q = 0; q < num_states; ++q) ++member_offsets[component_of_[q] + 1];
+  for (int c = 0; c < num_components_; ++c) member_offsets[c + 1] += member_offsets[c];
+  std::vector<Automaton::State> members(num_states);
+  {
+    std::vector<std::uint32_t> cursor(member_offsets.begin(), member_offsets.end() - 1);
+    for (int q = 0; q < num_states; ++q) members[cursor[component_of_[q]]++] = q;
+  }
+
+  // Marcas para no repetir estados ni componentes dentro de una misma fila
+  std::vector<int> state_mark(num_states, -1);
+  std::vector<int> component_mark(num_components_, -1);
+
+  offsets_.assign(num_components_ + 1, 0);
+  for (int c = 0; c < num_components_; ++c) {
+    offsets_[c] = static_cast<std::uint32_t>(states_.size());
+    component_mark[c] = c;
+    // Los estados de la propia componente
+    for (auto i = member_offsets[c]; i < member_offsets[c + 1]; ++i) {
+      state_mark[members[i]] = c;
+      states_.push_back(members[i]);
+    }
+    // Los cierres de las componentes sucesoras (ya calculados)
+    for (auto i = member_offsets[c]; i < member_offsets[c + 1]; ++i) {
+      for (auto dest : automaton.GetEpsilonTargets(members[i])) {
+        int d = component_of_[dest];
+        if (component_mark[d] == c) continue;
+        component_mark[d] = c;
+        for (auto k = offsets_[d]; k < offsets_[d + 1]; ++k) {
+          Automaton::State s = states_[k];
+          if (state_mark[s] == c) continue;
+          state_mark[s] = c;
+          states_.push_back(s);
+        }
+      }
+    }
+    // Presupuesto superado: la tabla queda incompleta
+    if (states_.size() > max_entries) {
+      complete_ = false;
+      std::vector<Automaton::State>().swap(states_);
+      std::vector<std::uint32_t>().swap(offsets_);
+      return;
+    }
+    offsets_[c + 1] = static_cast<std::uint32_t>(states_.size());
+    std::sort(states_.begin() + offsets_[c], states_.end());
+  }
+  states_.shrink_to_fit();
+}
+
+/**
+ * @brief Calcula las componentes fuertemente conexas del grafo de & (Tarjan).
+ *
+ * Versión iterativa con pila de llamadas explícita para no desbordar la pila
+ * con cadenas & de millones de estados.
+ */
+void EpsilonClosureTable::ComputeComponents(const Automaton& automaton) {
+  const int num_states = automaton.GetNumStates();
+  component_of_.assign(num_states, -1);
+  std::vector<int> index(num_states, -1); // Orden de descubrimiento
+  std::vector<int> low(num_states, 0); // Menor índice alcanzable
+  std::vector<Automaton::State> stack; // Pila de Tarjan
+  std::vector<char> on_stack(num_states, 0);
+  // Pila de llamadas: (estado, siguiente destino & por visitar)
+  std::vector<std::pair<Automaton::State, std::size_t>> calls;
+  int next_index = 0;
+
+  for (int root = 0; root < num_states; ++root) {
+    if (index[root] != -1) continue;
+    calls.emplace_back(root, 0);
+    while (!calls.empty()) {
+      Automaton::State v = calls.back().first;
+      std::size_t& pos = calls.back().second;
+      if (pos == 0 && index[v] == -1) {
+        // Primera visita de v
+        index[v] = low[v] = next_index++;
+        stack.push_back(v);
+        on_stack[v] = 1;
+      }
+      Automaton::StateRange targets = automaton.GetEpsilonTargets(v);
+      if (pos < targets.size()) {
+        Automaton::State w = targets.begin()[pos++];
+        if (index[w] == -1) {
+          calls.emplace_back(w, 0);
+        } else if (on_stack[w]) {
+          low[v] = std::min(low[v], index[w]);
+        }
+        continue;
+      }
+      // Todos los sucesores visitados: cerramos v
+      calls.pop_back();
+      if (!calls.empty()) {
+        Automaton::State parent = calls.back().first;
+        low[parent] = std::min(low[parent], low[v]);
+      }
+      if (low[v] == index[v]) {
+        // v es raíz de una componente: la sacamos de la pila
+        Automaton::State w;
+        do {
+          w = stack.back();
+          stack.pop_back();
+          on_stack[w] = 0;
+          component_of_[w] = num_components_;
+        } while (w != v);
+        ++num_components_;
+      }
+    }
+  }
+}
+
+/**
+ * @brief IsComplete: true si la tabla tiene todos los cierres.
+ */
+bool EpsilonClosureTable::IsComplete() const {
+  return complete_;
+}
+
+/**
+ * @brief Devuelve el cierre por & de un estado.
+ */
+Automaton::StateRange EpsilonClosureTable::GetClosure(Automaton::State state) const {
+  int c = component_of_[state];
+  const Automaton::State* base = states_.data();
+  return Automaton::StateRange(base + offsets_[c], base + offsets_[c + 1]);
+}
+
+/**
+ * @brief Añade a scratch.next el cierre de state, saltando los estados ya incluidos.
+ *
+ * Con la tabla completa es una fila; si no, un DFS por el grafo de & con
+ * scratch.worklist como pila.
+ */
+void EpsilonClosureTable::AppendClosure(Automaton::State state, SimulatorScratch& scratch,
+                                        Work* work) const {
+  // Generación y marcas en locales: una escritura en marks podría solapar
+  // scratch.generation, y el compilador la volvería a leer en cada estado
+  const std::uint32_t generation = scratch.generation;
+  std::uint32_t* marks = scratch.marks.data();
+  std::vector<Automaton::State>& next = scratch.next;
+  auto insert = [generation, marks, &next](Automaton::State s) {
+    if (marks[s] == generation) return false;
+    marks[s] = generation;
+    next.push_back(s);
+    return true;
+  };
+  if (complete_) {
+    Automaton::StateRange row = GetClosure(state);
+    for (auto s : row) insert(s);
+    if (work != nullptr) work->states += row.size();
+    return;
+  }
+  if (!insert(state)) return;
+  std::vector<Automaton::State>& pending = scratch.worklist;
+  pending.clear();
+  pending.push_back(state);
+  std::size_t visited = 0;
+  std::size_t edges = 0;
+  while (!pending.empty()) {
+    Automaton::State cur = pending.back();
+    pending.pop_back();
+    ++visited;
+    for (auto dest : automaton_.GetEpsilonTargets(cur)) {
+      ++edges;
+      if (insert(dest)) pending.push_back(dest);
+    }
+  }
+  if (work != nullptr) {
+    work->states += visited;
+    work->epsilon_edges += edges;
+  }
+}
+
+/**
+ * @brief IsTrivial: true si el cierre del estado es solo el propio estado.
+ *
+ * Si la tabla quedó incompleta (sin filas), basta mirar las transiciones &
+ * del estado: el cierre es trivial si todas son bucles sobre él mismo.
+ */
+bool EpsilonClosureTable::IsTrivial(Automaton::State state) const {
+  if (!complete_) {
+    Automaton::StateRange targets = automaton_.GetEpsilonTargets(state);
+    return std::all_of(targets.begin(), targets.end(),
+                       [state](Automaton::State s) { return s == state; });
+  }
+  int c = component_of_[state];
+  return offsets_[c + 1] - offsets_[c] == 1;
+}
+
+/**
+ * @brief Devuelve el número de componentes fuertemente conexas.
+ */
+int EpsilonClosureTable::GetNumComponents() const {
+  return num_components_;
+}
+
+}
@@ -0,0 +1,157 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: epsilon_closure.h: interfaz de la clase EpsilonClosureTable.
+ *    Contiene la tabla precalculada con el cierre por & de cada estado.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - AppendClosure con marcas por generación
+ *    16/10/2026 - AppendClosure sobre SimulatorScratch (pila del DFS sin reservas)
+ *    16/10/2026 - IsTrivial válido con la tabla incompleta
+ *    16/10/2026 - Step: paso de la simulación compartido por todos los motores
+*/
+
+/**
+ * @file epsilon_closure.h
+ * @brief Tabla de cierres por & calculada una sola vez por autómata.
+ *
+ * El cierre de cada estado no cambia tras cargar el autómata, así que se
+ * calcula al construir la tabla: se condensan las componentes fuertemente
+ * conexas (Tarjan) del grafo de transiciones & y se recorre el DAG resultante
+ * en orden topológico inverso, de forma que el cierre de cada componente es
+ * la unión de sus estados y de los cierres de sus sucesoras.
+ */
+
+#ifndef P06_SIMULATOR_EPSILON_CLOSURE_H_
+#define P06_SIMULATOR_EPSILON_CLOSURE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "automata.h"
+#include "simulator_scratch.h"
+
+namespace p06 {
+
+/**
+ * @brief Cierre por & de cada estado, guardado en formato CSR.
+ *
+ * Todos los estados de una misma componente comparten fila. Si la suma de
+ * los tamaños de los cierres supera el presupuesto de memoria (por ejemplo,
+ * cadenas & muy largas, cuyo cierre es cuadrático), la tabla queda
+ * incompleta y el usuario debe recurrir al recorrido BFS clásico.
+ */
+class EpsilonClosureTable {
+ public:
+  // Presupuesto por defecto de entradas de la tabla (4 bytes cada una)
+  static constexpr std::size_t kDefaultMaxEntries = std::size_t{1} << 25;
+
+  /**
+   * @brief Calcula la tabla de cierres del autómata.
+   * @param automaton Autómata congelado
+   * @param max_entries Número máximo de entradas antes de abandonar
+   */
+  explicit EpsilonClosureTable(const Automaton& automaton,
+                               std::size_t max_entries = kDefaultMaxEntries);
+
+  /**
+   * @brief true si la tabla contiene el cierre de todos los estados.
+   */
+  bool IsComplete() const;
+
+  /**
+   * @brief Devuelve el cierre por & de un estado (incluye al propio estado).
+   *
+   * Precondición: IsComplete() y state en rango.
+   */
+  Automaton::StateRange GetClosure(Automaton::State state) const;
+
+  /**
+   * @brief Trabajo hecho por AppendClosure (para SimulatorStats).
+   */
+  struct Work {
+    std::size_t states = 0; // Entradas de fila o estados recorridos por el DFS
+    std::size_t epsilon_edges = 0; // Transiciones & seguidas (solo sin tabla)
+    std::size_t closures = 0; // Llamadas a AppendClosure hechas por Step
+  };
+
+  /**
+   * @brief Añade a scratch.next los estados del cierre de state aún no incluidos.
+   *
+   * Con la tabla incompleta recorre el grafo de & (DFS) usando
+   * scratch.worklist como pila.
+   *
+   * @param state Estado cuyo cierre se añade
+   * @param scratch Memoria de trabajo preparada (Prepare) con un conjunto abierto
+   * @param work Si no es nulo, acumula aquí el trabajo hecho
+   */
+  void AppendClosure(Automaton::State state, SimulatorScratch& scratch,
+                     Work* work = nullptr) const;
+
+  /**
+   * @brief Paso de la simulación: abre un conjunto en scratch.next con el
+   * sucesor de states por la clase class_id, ya cerrado por &.
+   *
+   * Es el paso de todos los motores que trabajan con conjuntos del NFA
+   * (nfa, SimulationSession, lazy-dfa y la determinización). Un destino que
+   * ya está en next no se vuelve a cerrar: su cierre ya está dentro.
+   *
+   * @param states Conjunto de partida (no puede ser scratch.next)
+   * @param class_id Clase del símbolo leído (distinta de kNoClass)
+   * @param scratch Memoria de trabajo preparada (Prepare)
+   * @param work Si no es nulo, acumula aquí el trabajo hecho
+   *
+   * Se llama una vez por símbolo, así que va en línea.
+   */
+  void Step(const Automaton::StateVector& states, int class_id, SimulatorScratch& scratch,
+            Work* work = nullptr) const {
+    scratch.BeginSet();
+    std::size_t closures = 0;
+    for (auto s : states) {
+      for (auto dest : automaton_.GetTargets(s, class_id)) {
+        if (scratch.Contains(dest)) continue;
+        AppendClosure(dest, scratch, work);
+        ++closures;
+      }
+    }
+    if (work != nullptr) work->closures += closures;
+  }
+
+  /**
+   * @brief true si el cierre de state es solo {state} (sin transiciones &).
+   *
+   * Válido también con la tabla incompleta. Precondición: state en rango.
+   */
+  bool IsTrivial(Automaton::State state) const;
+
+  /**
+   * @brief Número de componentes fuertemente conexas del grafo de &.
+   */
+  int GetNumComponents() const;
+
+ private:
+  // Calcula component_of_ con Tarjan iterativo (sin recursión)
+  void ComputeComponents(const Automaton& automaton);
+
+  const Automaton& automaton_; // Autómata del que se calculan los cierres
+  bool complete_; // false si se superó el presupuesto
+  int num_components_; // Número de componentes
+  std::vector<int> component_of_; // Componente de cada estado
+  std::vector<std::uint32_t> offsets_; // Fila de cada componente
+  std::vector<Automaton::State> states_; // Cierres concatenados (ordenados)
+};
+
+}
+
+#endif
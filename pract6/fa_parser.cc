@@ -17,6 +17,10 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - El autómata se congela (CSR) al terminar el parseo
+ *    16/10/2026 - Tokenizador propio con std::from_chars sobre el fichero proyectado
+ *    16/10/2026 - Líneas de estado parseadas en paralelo por bloques
+ *    16/10/2026 - Transiciones repartidas directamente en el CSR del autómata
 */
 
 /**
@@ -25,34 +29,245 @@
  *
  * El parser realiza validaciones estrictas del formato del fichero .fa y
  * de la coherencia de los datos para asegurar que el autómata resultante es válido
+ *
+ * El fichero se proyecta en memoria y se recorre sin copias: las líneas son
+ * vistas sobre la proyección y los tokens se leen con LineScanner, que
+ * reproduce la semántica de operator>> (configuración "C") de la versión con
+ * istringstream, de modo que los mensajes de error no cambian.
+ *
+ * Las líneas de estado son independientes entre sí: una primera pasada las
+ * localiza (memchr) y la segunda las reparte en bloques de líneas
+ * consecutivas que se validan en paralelo, cada uno en sus propios buffers.
+ * Si hay errores, gana el del primer bloque que falla, que es el de la
+ * primera línea errónea, igual que en el parseo secuencial. Si no, las
+ * transiciones de los bloques se reparten directamente en el CSR por
+ * (estado, carácter), contado y reservado de una vez, y el autómata se
+ * congela sobre él (Automaton::FreezeFromRows).
  */
 
 #include "fa_parser.h"
 
-#include <fstream>
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <climits>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include "mapped_file.h"
+#include "work_stealing_pool.h"
+
 namespace p06 {
 
 /**
- * @brief Convierte un token (string) a char, solo si el token tiene longitud 1.
+ * @brief Lector de tokens de una línea con la semántica de operator>>.
  *
- * Uso:
- *  -Los símbolos del alfabeto y los símbolos de transición deben ser tokens
- *    de 1 carácter.
+ * Igual que un istringstream con la configuración "C": los separadores son
+ * los seis espacios de isspace, un entero es [+-]dígitos (la lectura se
+ * detiene en el primer carácter que no es dígito, aunque no sea un espacio)
+ * y un fallo es definitivo, como el failbit del flujo.
+ */
+class LineScanner {
+ public:
+  explicit LineScanner(std::string_view line) : line_(line), pos_(0), failed_(false) {}
+
+  /**
+   * @brief Lee un int (falla si no hay dígitos o si no cabe en un int).
+   */
+  bool ReadInt(int& value) {
+    if (failed_) return false;
+    SkipSpaces();
+    bool negative = false;
+    if (pos_ < line_.size() && (line_[pos_] == '+' || line_[pos_] == '-')) {
+      negative = line_[pos_++] == '-';
+    }
+    std::size_t digits = pos_;
+    while (pos_ < line_.size() && line_[pos_] >= '0' && line_[pos_] <= '9') ++pos_;
+    // from_chars sobre los dígitos en un entero más ancho para admitir INT_MIN
+    long long magnitude = 0;
+    auto result = std::from_chars(line_.data() + digits, line_.data() + pos_, magnitude);
+    if (digits == pos_ || result.ec != std::errc() ||
+        magnitude > (negative ? -static_cast<long long>(INT_MIN) : INT_MAX)) {
+      failed_ = true;
+      return false;
+    }
+    value = static_cast<int>(negative ? -magnitude : magnitude);
+    return true;
+  }
+
+  /**
+   * @brief Lee un token (secuencia de caracteres que no son espacios).
+   */
+  bool ReadToken(std::string_view& token) {
+    if (failed_) return false;
+    SkipSpaces();
+    std::size_t begin = pos_;
+    while (pos_ < line_.size() && !IsSpace(line_[pos_])) ++pos_;
+    if (begin == pos_) {
+      failed_ = true;
+      return false;
+    }
+    token = line_.substr(begin, pos_ - begin);
+    return true;
+  }
+
+ private:
+  static bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+  }
+
+  void SkipSpaces() {
+    while (pos_ < line_.size() && IsSpace(line_[pos_])) ++pos_;
+  }
+
+  std::string_view line_; // Línea completa
+  std::size_t pos_; // Siguiente carácter por leer
+  bool failed_; // true tras el primer fallo
+};
+
+/**
+ * @brief Extrae la siguiente línea de data a partir de pos (como std::getline).
+ * @return false si no quedan líneas
+ */
+static bool NextLine(std::string_view data, std::size_t& pos, std::string_view& line) {
+  if (pos >= data.size()) return false;
+  const char* begin = data.data() + pos;
+  const char* nl = static_cast<const char*>(std::memchr(begin, '\n', data.size() - pos));
+  std::size_t length = nl != nullptr ? static_cast<std::size_t>(nl - begin) : data.size() - pos;
+  line = data.substr(pos, length);
+  pos += length + (nl != nullptr ? 1 : 0);
+  return true;
+}
+
+// Tamaño mínimo de un bloque de líneas de estado: por debajo no compensa
+// repartir el trabajo
+static constexpr std::size_t kMinBlockBytes = std::size_t{1} << 20;
+
+/**
+ * @brief Transición leída de una línea de estado, pendiente de volcar.
+ */
+struct ParsedEdge {
+  int from;
+  char symbol;
+  int to;
+};
+
+/**
+ * @brief Bloque de líneas de estado consecutivas y su resultado.
+ */
+struct LineBlock {
+  std::size_t first_line = 0; // Primera línea (índice en las líneas de estado)
+  std::size_t last_line = 0; // Fin (exclusivo)
+  std::vector<ParsedEdge> edges; // Transiciones del bloque, en orden
+  std::vector<int> accepting; // Estados de aceptación del bloque
+  bool failed = false; // true si alguna línea es errónea
+  std::string err_msg; // Error de la primera línea errónea
+};
+
+/**
+ * @brief Valida una línea de estado y añade su contenido al bloque.
  *
- * @param token cadena leída desde el fichero
- * @param out_char salida con el carácter si token.size() == 1
- * @return true si conversion válida y se escribió out_char
+ * Formato por línea: "id accept num_trans symbol1 dest1 symbol2 dest2 ..."
+ * Solo lee el autómata (alfabeto), así que varias llamadas pueden ejecutarse
+ * a la vez sobre bloques distintos.
+ *
+ * @return false si la línea es errónea (err_msg describe el problema)
  */
-static bool TokenToChar(const std::string& token, char& out_char) {
-  if (token.size() != 1) return false;
-  out_char = token[0];
+static bool ParseStateLine(std::string_view state_line, int num_states,
+                           const Automaton& automaton, LineBlock& block,
+                           std::string& err_msg) {
+  // Tokenizamos la línea por espacios
+  LineScanner scanner(state_line);
+  int state_id;
+  int is_accept;
+  int n_trans;
+  // Leemos id de estado, aceptación y número de transiciones
+  if (!scanner.ReadInt(state_id) || !scanner.ReadInt(is_accept) ||
+      !scanner.ReadInt(n_trans)) {
+    err_msg = "Formato incorrecto en la línea de estado (id accept num_trans). Línea: " +
+              std::string(state_line);
+    return false;
+  }
+  // Validamos datos básicos del estado
+  if (state_id < 0 || state_id >= num_states) {
+    err_msg = "Identificador de estado fuera de rango: " + std::to_string(state_id);
+    return false;
+  }
+  // Validamos campo de aceptación
+  if (is_accept != 0 && is_accept != 1) {
+    err_msg = "Campo de aceptación debe ser 0 o 1. Línea: " + std::string(state_line);
+    return false;
+  }
+  // Validamos número de transiciones
+  if (n_trans < 0) {
+    err_msg = "Número de transiciones negativo en línea: " + std::string(state_line);
+    return false;
+  }
+  // Si es estado de aceptación, lo marcamos
+  if (is_accept == 1) block.accepting.push_back(state_id);
+
+  // Leer transiciones: cada transición es "symbol dest"
+  // Ejemplo: "0 1" significa con símbolo '0' va al estado 1
+  for (int t = 0; t < n_trans; ++t) {
+    std::string_view sym_token;
+    int dest;
+    // Leemos símbolo y estado destino
+    if (!scanner.ReadToken(sym_token) || !scanner.ReadInt(dest)) {
+      err_msg = "Faltan datos en transiciones para el estado " + std::to_string(state_id) +
+                ". Línea: " + std::string(state_line);
+      return false;
+    }
+    // Validamos símbolo de transición
+    if (sym_token.size() != 1) {
+      err_msg = "Símbolo de transición inválido (debe ser 1 carácter): '" +
+                std::string(sym_token) + "'";
+      return false;
+    }
+    char c = sym_token[0];
+    // Si no es epsilon, debe pertenecer al alfabeto
+    if (c != '&' && !automaton.IsSymbolInAlphabet(c)) {
+      err_msg = "Símbolo de transición '" + std::string(1, c) +
+                "' no pertenece al alfabeto.";
+      return false;
+    }
+    // Validamos estado destino
+    if (dest < 0 || dest >= num_states) {
+      err_msg = "Estado destino fuera de rango en transición desde " +
+                std::to_string(state_id) + ". Destino: " + std::to_string(dest);
+      return false;
+    }
+    block.edges.push_back(ParsedEdge{state_id, c, dest});
+  }
   return true;
 }
 
+/**
+ * @brief Parsea las líneas [first_line, last_line) del bloque, en orden.
+ *
+ * Se detiene en la primera línea errónea.
+ */
+static void ParseLineBlock(const std::vector<std::string_view>& state_lines,
+                           int num_states, const Automaton& automaton, LineBlock& block) {
+  for (std::size_t i = block.first_line; i < block.last_line; ++i) {
+    if (!ParseStateLine(state_lines[i], num_states, automaton, block, block.err_msg)) {
+      block.failed = true;
+      return;
+    }
+  }
+}
+
+// Constructor: hilos para las líneas de estado (0 = uno por núcleo)
+FAParser::FAParser(int num_threads)
+    : num_threads_(num_threads > 0
+                       ? num_threads
+                       : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))) {
+}
+
 /**
  * @brief Parsear un fichero .fa y poblar el autómata pasado por referencia.
  * @param filename Ruta al fichero .fa
@@ -63,34 +278,37 @@ static bool TokenToChar(const std::string& token, char& out_char) {
 bool FAParser::ParseFile(const std::string& filename,
                          Automaton& automaton,
                          std::string& err_msg) const {
-  // Abrimos fichero
-  std::ifstream ifs(filename);
-  if (!ifs) {
+  // Proyectamos el fichero
+  MappedFile file;
+  if (!file.Open(filename, err_msg)) {
     err_msg = "No se puede abrir fichero: " + filename;
     return false;
   }
+  std::string_view data = file.GetData();
+  std::size_t pos = 0;
 
   // Limpiamos automaton antes de poblarlo
   automaton.Clear();
 
-  std::string line;
+  std::string_view line;
 
   // Línea 1: alfabeto (símbolos separados por espacios)
-  if (!std::getline(ifs, line)) {
+  if (!NextLine(data, pos, line)) {
     err_msg = "Fichero vacío o formato incorrecto (línea de alfabeto).";
     return false;
   }
   {
     // Tokenizamos la línea por espacios y comprobamos cada símbolo
-    std::istringstream iss(line);
-    std::string token;
-    while (iss >> token) {
-      char c;
+    LineScanner scanner(line);
+    std::string_view token;
+    while (scanner.ReadToken(token)) {
       // Cada token del alfabeto debe ser exactamente 1 carácter
-      if (!TokenToChar(token, c)) {
-        err_msg = "Símbolo de alfabeto inválido (debe ser 1 carácter): '" + token + "'";
+      if (token.size() != 1) {
+        err_msg = "Símbolo de alfabeto inválido (debe ser 1 carácter): '" +
+                  std::string(token) + "'";
         return false;
       }
+      char c = token[0];
       // & está reservado y no puede ser parte del alfabeto
       if (c == '&') {
         err_msg = "El carácter '&' está reservado para epsilon y no puede formar parte del alfabeto.";
@@ -107,15 +325,15 @@ bool FAParser::ParseFile(const std::string& filename,
 
   // Línea 2: número total de estados
   // Leemos línea
-  if (!std::getline(ifs, line)) {
+  if (!NextLine(data, pos, line)) {
     err_msg = "Formato incorrecto: falta línea con número de estados.";
     return false;
   }
   int num_states = 0;
   {
     // Parseamos número de estados
-    std::istringstream iss(line);
-    if (!(iss >> num_states) || num_states < 1) {
+    LineScanner scanner(line);
+    if (!scanner.ReadInt(num_states) || num_states < 1) {
       err_msg = "Número de estados inválido o menor que 1.";
       return false;
     }
@@ -128,15 +346,15 @@ bool FAParser::ParseFile(const std::string& filename,
 
   // Línea 3: estado de arranque
   // Leemos línea
-  if (!std::getline(ifs, line)) {
+  if (!NextLine(data, pos, line)) {
     err_msg = "Formato incorrecto: falta línea con estado inicial.";
     return false;
   }
   {
     // Parseamos estado inicial
-    std::istringstream iss(line);
+    LineScanner scanner(line);
     int start;
-    if (!(iss >> start)) {
+    if (!scanner.ReadInt(start)) {
       err_msg = "Estado inicial inválido.";
       return false;
     }
@@ -152,88 +370,103 @@ bool FAParser::ParseFile(const std::string& filename,
     }
   }
 
-  // Una línea por cada estado (num_states líneas)
-  // Formato por línea: "id accept num_trans symbol1 dest1 symbol2 dest2 ..."
-  for (int i = 0; i < num_states; ++i) {
-    // Leemos línea
-    if (!std::getline(ifs, line)) {
-      err_msg = "Faltan líneas para la definición de los estados. Se esperaban " +
-                std::to_string(num_states) + " líneas (una por estado).";
-      return false;
-    }
-    // Tokenizamos la línea por espacios
-    std::istringstream iss(line);
-    int state_id;
-    int is_accept;
-    int n_trans;
-    // Leemos id de estado, aceptación y número de transiciones
-    if (!(iss >> state_id >> is_accept >> n_trans)) {
-      err_msg = "Formato incorrecto en la línea de estado (id accept num_trans). Línea: " + line;
-      return false;
+  // Primera pasada: localizamos las líneas de estado (como mucho num_states;
+  // las siguientes se ignoran)
+  std::vector<std::string_view> state_lines;
+  while (state_lines.size() < static_cast<std::size_t>(num_states) &&
+         NextLine(data, pos, line)) {
+    state_lines.push_back(line);
+  }
+
+  // Segunda pasada: bloques de líneas consecutivas de unos block_bytes bytes
+  // (4 por hilo para repartir bien la carga), parseados en paralelo
+  std::size_t section_bytes = 0;
+  if (!state_lines.empty()) {
+    section_bytes = static_cast<std::size_t>(state_lines.back().data() -
+                                             state_lines.front().data()) +
+                    state_lines.back().size();
+  }
+  const std::size_t block_bytes =
+      std::max(kMinBlockBytes, section_bytes / (4 * static_cast<std::size_t>(num_threads_)));
+  std::vector<LineBlock> blocks;
+  for (std::size_t i = 0; i < state_lines.size();) {
+    LineBlock block;
+    block.first_line = i;
+    const char* block_begin = state_lines[i].data();
+    while (i < state_lines.size() &&
+           static_cast<std::size_t>(state_lines[i].data() - block_begin) < block_bytes) {
+      ++i;
     }
-    // Validamos datos básicos del estado
-    if (state_id < 0 || state_id >= num_states) {
-      err_msg = "Identificador de estado fuera de rango: " + std::to_string(state_id);
-      return false;
+    block.last_line = i;
+    blocks.push_back(std::move(block));
+  }
+  if (blocks.size() == 1 || num_threads_ == 1) {
+    for (auto& block : blocks) {
+      ParseLineBlock(state_lines, num_states, automaton, block);
+      if (block.failed) break;
     }
-    // Validamos campo de aceptación
-    if (is_accept != 0 && is_accept != 1) {
-      err_msg = "Campo de aceptación debe ser 0 o 1. Línea: " + line;
-      return false;
+  } else {
+    // El destructor del pool espera a que terminen todos los bloques
+    WorkStealingPool pool(std::min(num_threads_, static_cast<int>(blocks.size())));
+    for (auto& block : blocks) {
+      pool.Submit([&state_lines, num_states, &automaton, &block](int) {
+        ParseLineBlock(state_lines, num_states, automaton, block);
+      });
     }
-    // Validamos número de transiciones
-    if (n_trans < 0) {
-      err_msg = "Número de transiciones negativo en línea: " + line;
+  }
+
+  // El primer bloque con error tiene la primera línea errónea
+  for (const auto& block : blocks) {
+    if (block.failed) {
+      err_msg = block.err_msg;
       return false;
     }
-    // Si es estado de aceptación, lo marcamos
-    if (is_accept == 1) {
-      if (!automaton.AddAcceptingState(state_id)) {
-        err_msg = "Error marcando estado de aceptación: " + std::to_string(state_id);
+  }
+  for (const auto& block : blocks) {
+    for (int state : block.accepting) {
+      if (!automaton.AddAcceptingState(state)) {
+        err_msg = "Error marcando estado de aceptación: " + std::to_string(state);
         return false;
       }
     }
+  }
+  if (state_lines.size() < static_cast<std::size_t>(num_states)) {
+    err_msg = "Faltan líneas para la definición de los estados. Se esperaban " +
+              std::to_string(num_states) + " líneas (una por estado).";
+    return false;
+  }
 
-    // Leer transiciones: cada transición es "symbol dest"
-    // Ejemplo: "0 1" significa con símbolo '0' va al estado 1
-    for (int t = 0; t < n_trans; ++t) {
-      std::string sym_token;
-      int dest;
-      // Leemos símbolo y estado destino
-      if (!(iss >> sym_token >> dest)) {
-        err_msg = "Faltan datos en transiciones para el estado " + std::to_string(state_id) +
-                  ". Línea: " + line;
-        return false;
-      }
-      char c;
-      // Validamos símbolo de transición
-      if (!TokenToChar(sym_token, c)) {
-        err_msg = "Símbolo de transición inválido (debe ser 1 carácter): '" + sym_token + "'";
-        return false;
-      }
-      // Si no es epsilon, debe pertenecer al alfabeto
-      if (c != '&' && !automaton.IsSymbolInAlphabet(c)) {
-        err_msg = "Símbolo de transición '" + std::string(1, c) +
-                  "' no pertenece al alfabeto.";
-        return false;
-      }
-      // Validamos estado destino
-      if (dest < 0 || dest >= num_states) {
-        err_msg = "Estado destino fuera de rango en transición desde " +
-                  std::to_string(state_id) + ". Destino: " + std::to_string(dest);
-        return false;
-      }
-      // Añadimos transición al autómata
-      if (!automaton.AddTransition(state_id, c, dest)) {
-        // Error inesperado al añadir transición
-        err_msg = "Error añadiendo transición: " + std::to_string(state_id) +
-                  " -" + std::string(1, c) + "-> " + std::to_string(dest);
-        return false;
-      }
-    }
+  // Si llegamos aquí, parseo correcto: repartimos las transiciones en filas
+  // (estado, carácter), con el alfabeto en orden y '&' al final, contando
+  // primero cuántas tiene cada fila para reservar el CSR una sola vez
+  std::array<int, 256> column_of;
+  column_of.fill(0);
+  std::size_t num_columns = 0;
+  for (char symbol : automaton.GetAlphabet()) {
+    column_of[static_cast<unsigned char>(symbol)] = static_cast<int>(num_columns++);
+  }
+  column_of[static_cast<unsigned char>('&')] = static_cast<int>(num_columns++);
+  auto row_of = [&column_of, num_columns](const ParsedEdge& edge) {
+    return static_cast<std::size_t>(edge.from) * num_columns +
+           static_cast<std::size_t>(column_of[static_cast<unsigned char>(edge.symbol)]);
+  };
+  const std::size_t num_rows = static_cast<std::size_t>(num_states) * num_columns;
+  std::vector<std::uint32_t> offsets(num_rows + 1, 0);
+  for (const auto& block : blocks) {
+    for (const auto& edge : block.edges) ++offsets[row_of(edge) + 1];
+  }
+  for (std::size_t r = 0; r < num_rows; ++r) offsets[r + 1] += offsets[r];
+
+  // offsets hace de cursor: al acabar, offsets[r] es el final de la fila r
+  std::vector<Automaton::State> targets(offsets[num_rows]);
+  for (auto& block : blocks) {
+    for (const auto& edge : block.edges) targets[offsets[row_of(edge)]++] = edge.to;
+    std::vector<ParsedEdge>().swap(block.edges);
   }
+  for (std::size_t r = num_rows; r > 0; --r) offsets[r] = offsets[r - 1];
+  offsets[0] = 0;
 
-  // Si llegamos aquí, parseo correcto
+  automaton.FreezeFromRows(std::move(offsets), std::move(targets));
   return true;
 }
 
@@ -17,6 +17,7 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - Número de hilos del parseo de las líneas de estado
 */
 
 /**
@@ -41,7 +42,12 @@ namespace p06 {
  */
 class FAParser {
  public:
-  FAParser() = default;
+  /**
+   * @brief Crea el parser.
+   * @param num_threads Hilos para parsear las líneas de estado (0 = uno por
+   *        núcleo). El resultado no depende del número de hilos.
+   */
+  explicit FAParser(int num_threads = 0);
 
   /**
    * @brief Parsear un fichero .fa y poblar el autómata pasado por referencia.
@@ -49,10 +55,15 @@ class FAParser {
    * @param automaton Referencia a Automaton a poblar
    * @param err_msg En caso de error se escribe aquí una descripción
    * @return true si el parseo y la validación fueron correctos
+   *
+   * Si el parseo es correcto, el autómata queda congelado (Automaton::Freeze).
    */
   bool ParseFile(const std::string& filename,
                  Automaton& automaton,
                  std::string& err_msg) const;
+
+ private:
+  int num_threads_; // Hilos para las líneas de estado
 };
 
 }
@@ -0,0 +1,266 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: fab_file.cc: implementación de la clase FabFile.
+ *    Contiene la serialización del autómata congelado y su carga validada
+ *    sobre un fichero proyectado.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Carga con comprobaciones O(1); verificación completa opcional
+*/
+
+/**
+ * @file fab_file.cc
+ * @brief Implementación del formato .fab.
+ *
+ * Formato .fab (binario, enteros en el orden de bytes de la máquina; todas
+ * las secciones de enteros quedan alineadas a 4 bytes):
+ *  - 8 bytes: "P06FAB" seguido de dos bytes 0
+ *  - uint32: versión (1)
+ *  - int32: número de estados, estado inicial, número de clases
+ *  - uint64: número de transiciones, número de transiciones &
+ *  - 256 int32: clase de cada carácter (-1 = fuera del alfabeto)
+ *  - (num_states * num_classes + 1) uint32: inicio de cada fila (q, clase)
+ *  - num_transitions int32: destinos
+ *  - (num_states + 1) uint32: inicio de cada fila &
+ *  - num_epsilon int32: destinos por &
+ *  - num_states bytes: aceptación de cada estado (0 o 1)
+ *  - relleno con ceros hasta múltiplo de 8
+ *  - uint64: suma de comprobación FNV-1a de todo lo anterior
+ */
+
+#include "fab_file.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "fnv1a.h"
+#include "mapped_file.h"
+
+namespace p06 {
+
+// Cabecera y versión del formato .fab
+static const char kFabMagic[8] = {'P', '0', '6', 'F', 'A', 'B', 0, 0};
+static constexpr std::uint32_t kFabVersion = 1;
+static constexpr std::size_t kHeaderBytes = 8 + 4 + 3 * 4 + 2 * 8;
+
+/**
+ * @brief Añade al buffer la representación binaria de un valor.
+ */
+template <typename T>
+static void AppendRaw(std::string& buffer, const T& value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Comprobación O(1) de un CSR: primer inicio 0 y último == num_targets.
+ */
+static bool HasValidBounds(const std::uint32_t* offsets, std::size_t num_rows,
+                           std::uint64_t num_targets) {
+  return offsets[0] == 0 && offsets[num_rows] == num_targets;
+}
+
+/**
+ * @brief Comprueba un CSR completo: inicios crecientes, último == num_targets y
+ * destinos en [0, num_states).
+ */
+static bool IsValidCsr(const std::uint32_t* offsets, std::size_t num_rows,
+                       const std::int32_t* targets, std::uint64_t num_targets,
+                       int num_states) {
+  if (!HasValidBounds(offsets, num_rows, num_targets)) return false;
+  for (std::size_t r = 0; r < num_rows; ++r) {
+    if (offsets[r] > offsets[r + 1]) return false;
+  }
+  for (std::uint64_t i = 0; i < num_targets; ++i) {
+    if (targets[i] < 0 || targets[i] >= num_states) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Escribe el autómata en formato .fab recorriendo sus filas CSR.
+ */
+bool FabFile::Write(const Automaton& automaton, const std::string& filename,
+                    std::string& err_msg) {
+  if (!automaton.IsFrozen()) {
+    err_msg = "El autómata debe estar congelado para escribirlo en formato .fab.";
+    return false;
+  }
+  const int num_states = automaton.GetNumStates();
+  const int num_classes = automaton.GetNumClasses();
+  std::uint64_t num_epsilon = 0;
+  for (int q = 0; q < num_states; ++q) num_epsilon += automaton.GetEpsilonTargets(q).size();
+
+  std::string buffer(kFabMagic, sizeof(kFabMagic));
+  AppendRaw(buffer, kFabVersion);
+  AppendRaw(buffer, static_cast<std::int32_t>(num_states));
+  AppendRaw(buffer, static_cast<std::int32_t>(automaton.GetStartState()));
+  AppendRaw(buffer, static_cast<std::int32_t>(num_classes));
+  AppendRaw(buffer, static_cast<std::uint64_t>(automaton.GetNumTransitions()));
+  AppendRaw(buffer, num_epsilon);
+  for (int class_id : automaton.GetClassTable()) {
+    AppendRaw(buffer, static_cast<std::int32_t>(class_id));
+  }
+
+  // CSR principal: inicios y destinos
+  std::uint32_t offset = 0;
+  AppendRaw(buffer, offset);
+  for (int q = 0; q < num_states; ++q) {
+    for (int c = 0; c < num_classes; ++c) {
+      offset += static_cast<std::uint32_t>(automaton.GetTargets(q, c).size());
+      AppendRaw(buffer, offset);
+    }
+  }
+  for (int q = 0; q < num_states; ++q) {
+    for (int c = 0; c < num_classes; ++c) {
+      for (auto dest : automaton.GetTargets(q, c)) {
+        AppendRaw(buffer, static_cast<std::int32_t>(dest));
+      }
+    }
+  }
+
+  // CSR de &
+  offset = 0;
+  AppendRaw(buffer, offset);
+  for (int q = 0; q < num_states; ++q) {
+    offset += static_cast<std::uint32_t>(automaton.GetEpsilonTargets(q).size());
+    AppendRaw(buffer, offset);
+  }
+  for (int q = 0; q < num_states; ++q) {
+    for (auto dest : automaton.GetEpsilonTargets(q)) {
+      AppendRaw(buffer, static_cast<std::int32_t>(dest));
+    }
+  }
+
+  for (int q = 0; q < num_states; ++q) {
+    buffer.push_back(automaton.IsAcceptingState(q) ? 1 : 0);
+  }
+  buffer.resize((buffer.size() + 7) / 8 * 8, 0);
+  AppendRaw(buffer, Fnv1a64(buffer.data(), buffer.size()));
+
+  std::ofstream ofs(filename, std::ios::binary);
+  if (!ofs) {
+    err_msg = "No se puede crear fichero: " + filename;
+    return false;
+  }
+  ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  if (!ofs) {
+    err_msg = "Error escribiendo fichero: " + filename;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Proyecta y valida un .fab y lo asigna como vista al autómata.
+ *
+ * Sin verify solo se tocan la cabecera, la tabla de clases y los extremos de
+ * los CSR (unas pocas páginas); el resto del fichero se lee bajo demanda
+ * durante la simulación.
+ */
+bool FabFile::Load(const std::string& filename, Automaton& automaton,
+                   std::string& err_msg, bool verify) {
+  auto file = std::make_shared<MappedFile>();
+  if (!file->Open(filename, err_msg)) return false;
+  std::string_view data = file->GetData();
+
+  // Cabecera, versión y (con verify) suma de comprobación
+  if (data.size() < kHeaderBytes + sizeof(std::uint64_t) ||
+      std::memcmp(data.data(), kFabMagic, sizeof(kFabMagic)) != 0) {
+    err_msg = "El fichero no tiene formato .fab: " + filename;
+    return false;
+  }
+  std::size_t body = data.size() - sizeof(std::uint64_t);
+  if (verify) {
+    std::uint64_t checksum;
+    std::memcpy(&checksum, data.data() + body, sizeof(checksum));
+    if (checksum != Fnv1a64(data.data(), body)) {
+      err_msg = "Suma de comprobación incorrecta en fichero: " + filename;
+      return false;
+    }
+  }
+  std::uint32_t version;
+  std::int32_t num_states, start, num_classes;
+  std::uint64_t num_transitions, num_epsilon;
+  const char* pos = data.data() + sizeof(kFabMagic);
+  std::memcpy(&version, pos, 4);
+  std::memcpy(&num_states, pos + 4, 4);
+  std::memcpy(&start, pos + 8, 4);
+  std::memcpy(&num_classes, pos + 12, 4);
+  std::memcpy(&num_transitions, pos + 16, 8);
+  std::memcpy(&num_epsilon, pos + 24, 8);
+  if (version != kFabVersion) {
+    err_msg = "Versión de formato .fab no soportada.";
+    return false;
+  }
+  constexpr std::uint64_t kMaxIndex = std::numeric_limits<std::uint32_t>::max();
+  if (num_states < 1 || start < 0 || start >= num_states || num_classes < 1 ||
+      num_classes > 256 || num_transitions > kMaxIndex || num_epsilon > kMaxIndex) {
+    err_msg = "Cabecera .fab inválida.";
+    return false;
+  }
+
+  // Tamaño esperado de cada sección
+  const std::uint64_t num_rows = static_cast<std::uint64_t>(num_states) * num_classes;
+  const std::uint64_t offsets_at = kHeaderBytes + 256 * 4;
+  const std::uint64_t targets_at = offsets_at + (num_rows + 1) * 4;
+  const std::uint64_t epsilon_offsets_at = targets_at + num_transitions * 4;
+  const std::uint64_t epsilon_targets_at = epsilon_offsets_at + (num_states + 1ULL) * 4;
+  const std::uint64_t accepting_at = epsilon_targets_at + num_epsilon * 4;
+  const std::uint64_t padded = (accepting_at + num_states + 7) / 8 * 8;
+  if (padded != body) {
+    err_msg = "Tamaño de fichero .fab incorrecto.";
+    return false;
+  }
+
+  // Las secciones se usan en su sitio (alineadas a 4 bytes)
+  Automaton::FrozenView view;
+  view.num_states = num_states;
+  view.start_state = start;
+  view.num_classes = num_classes;
+  const char* base = data.data();
+  const auto* class_of = reinterpret_cast<const std::int32_t*>(base + kHeaderBytes);
+  for (int c = 0; c < 256; ++c) {
+    if (class_of[c] < Automaton::kNoClass || class_of[c] >= num_classes) {
+      err_msg = "Clase de símbolo fuera de rango en fichero .fab.";
+      return false;
+    }
+    view.class_of[c] = class_of[c];
+  }
+  view.offsets = reinterpret_cast<const std::uint32_t*>(base + offsets_at);
+  view.targets = reinterpret_cast<const Automaton::State*>(base + targets_at);
+  view.epsilon_offsets = reinterpret_cast<const std::uint32_t*>(base + epsilon_offsets_at);
+  view.epsilon_targets = reinterpret_cast<const Automaton::State*>(base + epsilon_targets_at);
+  view.accepting = reinterpret_cast<const std::uint8_t*>(base + accepting_at);
+  view.num_transitions = static_cast<std::size_t>(num_transitions);
+  bool valid = verify
+      ? IsValidCsr(view.offsets, num_rows, view.targets, num_transitions, num_states) &&
+            IsValidCsr(view.epsilon_offsets, num_states, view.epsilon_targets,
+                       num_epsilon, num_states)
+      : HasValidBounds(view.offsets, num_rows, num_transitions) &&
+            HasValidBounds(view.epsilon_offsets, num_states, num_epsilon);
+  if (!valid) {
+    err_msg = "Transición fuera de rango en fichero .fab.";
+    return false;
+  }
+  view.owner = std::move(file);
+  automaton.AssignView(std::move(view));
+  return true;
+}
+
+}
@@ -0,0 +1,82 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: fab_file.h: interfaz de la clase FabFile.
+ *    Contiene la escritura y la carga (proyección en memoria) del formato
+ *    binario .fab de un Automaton congelado.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Carga con comprobaciones O(1); verificación completa opcional
+*/
+
+/**
+ * @file fab_file.h
+ * @brief Interfaz del formato binario .fab.
+ *
+ * Parsear un .fa de millones de transiciones lleva segundos. El .fab guarda
+ * el autómata ya congelado (tabla de clases, CSR y aceptación) con la misma
+ * disposición que usa Automaton en memoria, de modo que al cargarlo se
+ * proyecta y se usa en su sitio: sin parseo ni copias, y varios procesos
+ * que carguen el mismo fichero comparten las páginas físicas.
+ */
+
+#ifndef P06_AUTOMATON_FAB_FILE_H_
+#define P06_AUTOMATON_FAB_FILE_H_
+
+#include <string>
+
+#include "automata.h"
+
+namespace p06 {
+
+/**
+ * @brief Lectura y escritura de autómatas en formato .fab.
+ */
+class FabFile {
+ public:
+  /**
+   * @brief Escribe un autómata congelado en formato .fab.
+   * @param automaton Autómata congelado
+   * @param filename Fichero de salida
+   * @param err_msg En caso de error se escribe aquí una descripción
+   * @return true en caso de éxito
+   */
+  static bool Write(const Automaton& automaton, const std::string& filename,
+                    std::string& err_msg);
+
+  /**
+   * @brief Proyecta un fichero .fab y lo asigna como vista al autómata.
+   *
+   * Por defecto solo hace comprobaciones O(1): cabecera, versión, tamaño de
+   * cada sección, tabla de clases y extremos de los CSR. El contenido de las
+   * secciones no se lee, así que la carga no depende del tamaño del fichero;
+   * a cambio, un .fab corrupto por dentro puede dar veredictos erróneos o
+   * accesos fuera de rango. Con verify se comprueban además la suma de
+   * comprobación y los rangos de todos los índices (O(tamaño)): --compile lo
+   * hace una vez sobre el fichero recién escrito y --verify lo pide para
+   * ficheros de origen no fiable. El autómata mantiene la proyección
+   * mientras exista (o hasta Clear()).
+   *
+   * @param filename Fichero .fab
+   * @param automaton Salida: autómata congelado sobre la proyección
+   * @param err_msg En caso de error se escribe aquí una descripción
+   * @param verify Si es true, verificación completa del contenido
+   * @return true si el fichero es válido
+   */
+  static bool Load(const std::string& filename, Automaton& automaton,
+                   std::string& err_msg, bool verify = false);
+};
+
+}
+
+#endif
@@ -0,0 +1,48 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: fnv1a.h: suma de comprobación FNV-1a de 64 bits.
+ *    Compartida por los formatos binarios .dfa y .fab.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    G. Fowler, L. C. Noll, K.-P. Vo, "FNV hash", http://www.isthe.com/chongo/tech/comp/fnv/
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file fnv1a.h
+ * @brief Suma de comprobación de los ficheros binarios.
+ */
+
+#ifndef P06_UTIL_FNV1A_H_
+#define P06_UTIL_FNV1A_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace p06 {
+
+/**
+ * @brief Suma de comprobación FNV-1a de 64 bits de size bytes.
+ */
+inline std::uint64_t Fnv1a64(const char* data, std::size_t size) {
+  std::uint64_t hash = 1469598103934665603ULL;
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+}
+
+#endif
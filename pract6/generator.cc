@@ -0,0 +1,575 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: generator.cc: generador de autómatas y cadenas sintéticos.
+ *    Escribe un .fa aleatorio (en el formato de FAParser) y un fichero de
+ *    cadenas con una proporción dada de aceptadas y rechazadas.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    S. Vigna, "SplitMix64", https://prng.di.unimi.it/splitmix64.c
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Cadenas rechazadas por construcción (prefijos muertos)
+*/
+
+/**
+ * @file generator.cc
+ * @brief Generador reproducible de cargas de trabajo.
+ *
+ * Uso:
+ *  ./p06_generator salida [opciones]   (escribe salida.fa y salida.txt)
+ *
+ * Con la misma semilla y las mismas opciones la salida es idéntica byte a
+ * byte en cualquier plataforma: se usa un generador propio (SplitMix64) y
+ * no las distribuciones de <random>, cuyo resultado depende de la
+ * biblioteca estándar.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "automata.h"
+#include "automata_simulator.h"
+
+namespace {
+
+// Símbolos disponibles, en orden (el alfabeto de tamaño k son los k primeros)
+const char kSymbols[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+constexpr int kMaxAlphabet = sizeof(kSymbols) - 1;
+
+// Intentos de generar al azar una cadena rechazada, cuando la búsqueda de
+// RejectionSearch no da ninguna de esa longitud, antes de aceptar la que salga
+constexpr int kRejectAttempts = 4;
+
+// Límites de RejectionSearch: conjuntos explorados, estados por conjunto y
+// cadenas guardadas de cada tipo
+constexpr std::size_t kSearchNodes = 4096;
+constexpr std::size_t kSearchSetSize = 64;
+constexpr std::size_t kSearchSamples = 8;
+
+/**
+ * @brief Generador pseudoaleatorio SplitMix64 (resultado idéntico en toda plataforma).
+ */
+class SplitMix64 {
+ public:
+  explicit SplitMix64(std::uint64_t seed) : state_(seed) {}
+
+  std::uint64_t Next() {
+    std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+  // Entero en [0, n) (el sesgo del módulo es despreciable para n pequeño)
+  std::uint64_t Below(std::uint64_t n) { return Next() % n; }
+  // true con probabilidad p
+  bool Chance(double p) { return static_cast<double>(Next() >> 11) * 0x1.0p-53 < p; }
+
+ private:
+  std::uint64_t state_;
+};
+
+/**
+ * @brief Parámetros de la generación (opciones de la línea de órdenes).
+ */
+struct Options {
+  std::uint64_t seed = 1;
+  int num_states = 100;
+  int alphabet_size = 2;
+  int out_degree = 2; // Transiciones por estado
+  double epsilon = 0.0; // Fracción de transiciones por '&' (estados no deterministas)
+  double determinism = 0.0; // Fracción de estados deterministas
+  double accepting = 0.1; // Fracción de estados de aceptación
+  int num_strings = 1000;
+  double accept_ratio = 0.5; // Fracción buscada de cadenas aceptadas
+  int min_length = 0;
+  int max_length = 32;
+  bool geometric = false; // Longitudes geométricas (si no, uniformes)
+};
+
+/**
+ * @brief Transición del autómata generado.
+ */
+struct Edge {
+  char symbol; // '&' para epsilon
+  int to;
+};
+
+/**
+ * @brief Autómata generado como listas de adyacencia.
+ */
+struct Graph {
+  std::string alphabet;
+  std::vector<std::vector<Edge>> edges;
+  std::vector<bool> accepting;
+};
+
+/**
+ * @brief Genera estados, aceptación y transiciones según las opciones.
+ *
+ * Un estado determinista usa símbolos distintos y ningún '&' (su grado se
+ * limita al tamaño del alfabeto); el resto elige cada símbolo al azar y
+ * cada transición es '&' con probabilidad epsilon.
+ */
+Graph MakeGraph(const Options& options, SplitMix64& rng) {
+  Graph graph;
+  graph.alphabet.assign(kSymbols, options.alphabet_size);
+  const int n = options.num_states;
+  graph.edges.resize(n);
+  graph.accepting.resize(n);
+  std::vector<char> shuffled(graph.alphabet.begin(), graph.alphabet.end());
+  for (int q = 0; q < n; ++q) {
+    graph.accepting[q] = rng.Chance(options.accepting);
+    if (rng.Chance(options.determinism)) {
+      // Fisher-Yates parcial: los primeros símbolos de una permutación
+      int degree = std::min(options.out_degree, options.alphabet_size);
+      for (int i = 0; i < degree; ++i) {
+        std::swap(shuffled[i], shuffled[i + rng.Below(shuffled.size() - i)]);
+        graph.edges[q].push_back({shuffled[i], static_cast<int>(rng.Below(n))});
+      }
+    } else {
+      for (int i = 0; i < options.out_degree; ++i) {
+        char symbol = rng.Chance(options.epsilon) ? '&'
+                                                  : graph.alphabet[rng.Below(graph.alphabet.size())];
+        graph.edges[q].push_back({symbol, static_cast<int>(rng.Below(n))});
+      }
+    }
+  }
+  return graph;
+}
+
+/**
+ * @brief Caminos más cortos (en símbolos) de cada estado a la aceptación.
+ */
+struct Distances {
+  std::vector<int> dist; // Símbolos hasta aceptar (INT_MAX si no se puede)
+  std::vector<Edge> next; // Primera transición del camino más corto
+};
+
+/**
+ * @brief Calcula Distances con un BFS 0-1 hacia atrás.
+ *
+ * Las transiciones '&' cuestan 0 y las demás 1. next forma un árbol de
+ * caminos más cortos: seguirlo llega siempre a un estado de aceptación,
+ * incluso a través de ciclos de '&'.
+ */
+Distances DistanceToAccept(const Graph& graph) {
+  const int n = static_cast<int>(graph.edges.size());
+  std::vector<std::vector<Edge>> reverse(n);
+  for (int q = 0; q < n; ++q) {
+    for (const Edge& e : graph.edges[q]) reverse[e.to].push_back({e.symbol, q});
+  }
+  constexpr int kInf = std::numeric_limits<int>::max();
+  Distances result{std::vector<int>(n, kInf), std::vector<Edge>(n, Edge{'&', -1})};
+  std::vector<int>& dist = result.dist;
+  std::deque<int> queue;
+  for (int q = 0; q < n; ++q) {
+    if (graph.accepting[q]) {
+      dist[q] = 0;
+      queue.push_back(q);
+    }
+  }
+  while (!queue.empty()) {
+    int q = queue.front();
+    queue.pop_front();
+    for (const Edge& e : reverse[q]) {
+      int cost = e.symbol == '&' ? 0 : 1;
+      if (dist[q] + cost < dist[e.to]) {
+        dist[e.to] = dist[q] + cost;
+        result.next[e.to] = Edge{e.symbol, q};
+        if (cost == 0) {
+          queue.push_front(e.to);
+        } else {
+          queue.push_back(e.to);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Cadenas rechazadas halladas con una búsqueda acotada sobre subconjuntos.
+ *
+ * dead_prefixes llevan a un conjunto en el que ningún estado alcanza la
+ * aceptación (o vacío): cualquier cadena que empiece por uno de ellos es
+ * rechazada, sea cual sea el resto. rejected[d] son cadenas de longitud d
+ * rechazadas tal cual.
+ */
+struct Rejections {
+  std::vector<std::string> dead_prefixes; // Ordenados por longitud
+  std::vector<std::vector<std::string>> rejected; // Por longitud
+};
+
+/**
+ * @brief Añade a set el cierre por & de state; false si supera kSearchSetSize.
+ */
+bool AddClosure(const Graph& graph, int state, std::vector<int>& set) {
+  std::vector<int> stack{state};
+  while (!stack.empty()) {
+    int q = stack.back();
+    stack.pop_back();
+    if (std::find(set.begin(), set.end(), q) != set.end()) continue;
+    if (set.size() == kSearchSetSize) return false;
+    set.push_back(q);
+    for (const Edge& e : graph.edges[q]) {
+      if (e.symbol == '&') stack.push_back(e.to);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief BFS sobre los conjuntos de estados pequeños alcanzables desde el inicial.
+ *
+ * Es la construcción de subconjuntos limitada a conjuntos de como mucho
+ * kSearchSetSize estados y a kSearchNodes conjuntos distintos, así que su
+ * coste no depende del tamaño del autómata. Como es en anchura, los prefijos
+ * muertos salen ordenados de más corto a más largo. Un conjunto muerto no se
+ * expande: todos sus sucesores también lo son.
+ */
+Rejections RejectionSearch(const Graph& graph, const Distances& distances) {
+  constexpr int kInf = std::numeric_limits<int>::max();
+  Rejections result;
+  std::vector<int> start;
+  if (!AddClosure(graph, 0, start)) return result;
+  std::sort(start.begin(), start.end());
+  std::set<std::vector<int>> seen{start};
+  std::deque<std::pair<std::vector<int>, std::string>> queue;
+  queue.emplace_back(std::move(start), std::string());
+  while (!queue.empty()) {
+    auto [set, word] = std::move(queue.front());
+    queue.pop_front();
+    bool dead = std::all_of(set.begin(), set.end(),
+                            [&](int q) { return distances.dist[q] == kInf; });
+    if (dead) {
+      if (result.dead_prefixes.size() < kSearchSamples) result.dead_prefixes.push_back(word);
+      continue;
+    }
+    bool accepts = std::any_of(set.begin(), set.end(),
+                               [&](int q) { return graph.accepting[q]; });
+    if (!accepts) {
+      if (result.rejected.size() <= word.size()) result.rejected.resize(word.size() + 1);
+      auto& same_length = result.rejected[word.size()];
+      if (same_length.size() < kSearchSamples) same_length.push_back(word);
+    }
+    for (char symbol : graph.alphabet) {
+      if (seen.size() >= kSearchNodes) break;
+      std::vector<int> next;
+      bool small = true;
+      for (std::size_t i = 0; small && i < set.size(); ++i) {
+        for (const Edge& e : graph.edges[set[i]]) {
+          if (e.symbol == symbol) small = small && AddClosure(graph, e.to, next);
+        }
+      }
+      if (!small) continue;
+      std::sort(next.begin(), next.end());
+      if (seen.insert(next).second) queue.emplace_back(std::move(next), word + symbol);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Cadena rechazada de longitud length por construcción, si la búsqueda
+ * dio alguna.
+ *
+ * Prefijo muerto (al azar entre los que caben) completado con símbolos
+ * aleatorios o, si no cabe ninguno, una cadena rechazada de esa longitud.
+ *
+ * @return false si no hay ninguna de esa longitud
+ */
+bool MakeRejected(const Graph& graph, const Rejections& rejections, int length,
+                  SplitMix64& rng, std::string& word) {
+  std::size_t fitting = 0;
+  while (fitting < rejections.dead_prefixes.size() &&
+         static_cast<int>(rejections.dead_prefixes[fitting].size()) <= length) {
+    ++fitting;
+  }
+  if (fitting > 0) {
+    word = rejections.dead_prefixes[rng.Below(fitting)];
+    while (static_cast<int>(word.size()) < length) {
+      word += graph.alphabet[rng.Below(graph.alphabet.size())];
+    }
+    return true;
+  }
+  if (length < static_cast<int>(rejections.rejected.size()) &&
+      !rejections.rejected[length].empty()) {
+    const auto& same_length = rejections.rejected[length];
+    word = same_length[rng.Below(same_length.size())];
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Cadena aceptada de longitud cercana a length (camino hasta aceptación).
+ *
+ * Paseo aleatorio por transiciones desde las que aún se acepta en length
+ * símbolos hasta que solo quedan los del camino más corto; después, ese
+ * camino. La cadena es aceptada por construcción; solo es más larga que
+ * length si el estado inicial está a más distancia de la aceptación.
+ */
+std::string MakeAccepted(const Graph& graph, const Distances& distances, int length,
+                         SplitMix64& rng) {
+  constexpr int kInf = std::numeric_limits<int>::max();
+  const std::vector<int>& dist = distances.dist;
+  std::string word;
+  int q = 0;
+  std::vector<const Edge*> options;
+  // Límite de pasos (los '&' no consumen longitud y podrían ciclar)
+  for (int steps = 0; steps < 4 * length + 16 && static_cast<int>(word.size()) + dist[q] < length;
+       ++steps) {
+    // Preferimos las transiciones que aún permiten aceptar en length símbolos
+    options.clear();
+    const int left = length - static_cast<int>(word.size());
+    for (const Edge& e : graph.edges[q]) {
+      int cost = e.symbol == '&' ? 0 : 1;
+      if (dist[e.to] != kInf && cost + dist[e.to] <= left) options.push_back(&e);
+    }
+    if (options.empty()) break;
+    const Edge& e = *options[rng.Below(options.size())];
+    if (e.symbol != '&') word += e.symbol;
+    q = e.to;
+  }
+  // Camino más corto por el árbol de DistanceToAccept
+  while (!graph.accepting[q]) {
+    const Edge& e = distances.next[q];
+    if (e.symbol != '&') word += e.symbol;
+    q = e.to;
+  }
+  return word;
+}
+
+/**
+ * @brief Longitud según la distribución elegida.
+ *
+ * Geométrica: min_length + número de fallos antes del primer éxito, con
+ * media (min_length + max_length) / 2 y truncada a max_length.
+ */
+int MakeLength(const Options& options, SplitMix64& rng) {
+  int span = options.max_length - options.min_length;
+  if (!options.geometric) return options.min_length + static_cast<int>(rng.Below(span + 1));
+  double p = 1.0 / (1.0 + span / 2.0);
+  int length = options.min_length;
+  while (length < options.max_length && !rng.Chance(p)) ++length;
+  return length;
+}
+
+/**
+ * @brief Escribe el autómata en el formato que acepta FAParser::ParseFile.
+ */
+bool WriteFa(const Graph& graph, const std::string& filename) {
+  std::ofstream ofs(filename);
+  if (!ofs) return false;
+  for (std::size_t i = 0; i < graph.alphabet.size(); ++i) {
+    ofs << (i ? " " : "") << graph.alphabet[i];
+  }
+  ofs << "\n" << graph.edges.size() << "\n0\n";
+  for (std::size_t q = 0; q < graph.edges.size(); ++q) {
+    ofs << q << " " << (graph.accepting[q] ? 1 : 0) << " " << graph.edges[q].size();
+    for (const Edge& e : graph.edges[q]) ofs << " " << e.symbol << " " << e.to;
+    ofs << "\n";
+  }
+  return static_cast<bool>(ofs);
+}
+
+/**
+ * @brief Convierte value en entero de [min, max]; false si no es válido.
+ */
+bool ParseInt(const std::string& value, long long min, long long max, long long& out) {
+  char* end = nullptr;
+  errno = 0;
+  out = std::strtoll(value.c_str(), &end, 10);
+  return !value.empty() && *end == '\0' && errno == 0 && out >= min && out <= max;
+}
+
+/**
+ * @brief Convierte value en fracción de [0, 1]; false si no es válido.
+ */
+bool ParseRatio(const std::string& value, double& out) {
+  char* end = nullptr;
+  out = std::strtod(value.c_str(), &end);
+  return !value.empty() && *end == '\0' && out >= 0.0 && out <= 1.0;
+}
+
+void PrintUsage() {
+  std::cout
+      << "Modo de empleo: ./p06_generator salida [opciones]\n"
+      << "Escribe salida.fa y salida.txt. Opciones (valor por defecto):\n"
+      << "  --seed N            Semilla (1)\n"
+      << "  --states N          Número de estados (100)\n"
+      << "  --alphabet N        Tamaño del alfabeto, 1-" << kMaxAlphabet << " (2)\n"
+      << "  --out-degree N      Transiciones por estado (2)\n"
+      << "  --epsilon P         Fracción de transiciones por & (0)\n"
+      << "  --determinism P     Fracción de estados deterministas (0)\n"
+      << "  --accepting P       Fracción de estados de aceptación (0.1)\n"
+      << "  --strings N         Número de cadenas (1000)\n"
+      << "  --accept-ratio P    Fracción buscada de cadenas aceptadas (0.5)\n"
+      << "  --min-length N      Longitud mínima (0)\n"
+      << "  --max-length N      Longitud máxima (32)\n"
+      << "  --length-dist D     uniform o geometric (uniform)\n";
+}
+
+}
+
+/**
+ * @brief Programa principal del generador.
+ *
+ * Pasos principales:
+ *  -Lee las opciones y las valida.
+ *  -Genera el autómata y lo escribe en salida.fa.
+ *  -Genera cada cadena: aceptada (camino hasta aceptación) con probabilidad
+ *   accept-ratio y, si no, rechazada por construcción (RejectionSearch). Solo
+ *   si la búsqueda no dio ninguna de esa longitud se prueban cadenas
+ *   aleatorias con AutomatonSimulator (kRejectAttempts intentos). Escribe
+ *   salida.txt (& = cadena vacía).
+ *  -Informa de las cadenas aceptadas y rechazadas realmente escritas: el
+ *   veredicto se conoce al construir cada cadena, sin volver a simularla.
+ */
+int main(int argc, char* argv[]) {
+  if (argc < 2 || std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h") {
+    PrintUsage();
+    return argc < 2 ? 1 : 0;
+  }
+  std::string prefix = argv[1];
+  Options options;
+  for (int i = 2; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (i + 1 >= argc) {
+      std::cerr << "Falta el valor de " << opt << "\n";
+      return 1;
+    }
+    std::string value = argv[++i];
+    long long number = 0;
+    bool ok = true;
+    if (opt == "--seed") {
+      ok = ParseInt(value, 0, std::numeric_limits<long long>::max(), number);
+      options.seed = static_cast<std::uint64_t>(number);
+    } else if (opt == "--states") {
+      ok = ParseInt(value, 1, 1 << 30, number);
+      options.num_states = static_cast<int>(number);
+    } else if (opt == "--alphabet") {
+      ok = ParseInt(value, 1, kMaxAlphabet, number);
+      options.alphabet_size = static_cast<int>(number);
+    } else if (opt == "--out-degree") {
+      ok = ParseInt(value, 0, 1 << 20, number);
+      options.out_degree = static_cast<int>(number);
+    } else if (opt == "--strings") {
+      ok = ParseInt(value, 0, 1 << 30, number);
+      options.num_strings = static_cast<int>(number);
+    } else if (opt == "--min-length") {
+      ok = ParseInt(value, 0, 1 << 30, number);
+      options.min_length = static_cast<int>(number);
+    } else if (opt == "--max-length") {
+      ok = ParseInt(value, 0, 1 << 30, number);
+      options.max_length = static_cast<int>(number);
+    } else if (opt == "--epsilon") {
+      ok = ParseRatio(value, options.epsilon);
+    } else if (opt == "--determinism") {
+      ok = ParseRatio(value, options.determinism);
+    } else if (opt == "--accepting") {
+      ok = ParseRatio(value, options.accepting);
+    } else if (opt == "--accept-ratio") {
+      ok = ParseRatio(value, options.accept_ratio);
+    } else if (opt == "--length-dist") {
+      ok = value == "uniform" || value == "geometric";
+      options.geometric = value == "geometric";
+    } else {
+      std::cerr << "Opción desconocida: " << opt << "\n";
+      PrintUsage();
+      return 1;
+    }
+    if (!ok) {
+      std::cerr << "Valor de " << opt << " inválido: " << value << "\n";
+      return 1;
+    }
+  }
+  if (options.min_length > options.max_length) {
+    std::cerr << "--min-length no puede superar a --max-length\n";
+    return 1;
+  }
+
+  // Generadores independientes para el autómata y las cadenas: cambiar las
+  // opciones de las cadenas no cambia el autómata
+  SplitMix64 graph_rng(options.seed);
+  SplitMix64 strings_rng(options.seed ^ 0x5DEECE66DULL);
+  Graph graph = MakeGraph(options, graph_rng);
+  if (!WriteFa(graph, prefix + ".fa")) {
+    std::cerr << "No se puede crear fichero: " << prefix << ".fa\n";
+    return 3;
+  }
+
+  // Autómata equivalente en memoria para clasificar las cadenas aleatorias
+  // (el simulador solo se construye si alguna cadena lo necesita)
+  p06::Automaton automaton;
+  for (char symbol : graph.alphabet) automaton.AddSymbol(symbol);
+  automaton.SetNumStates(options.num_states);
+  automaton.SetStartState(0);
+  for (int q = 0; q < options.num_states; ++q) {
+    if (graph.accepting[q]) automaton.AddAcceptingState(q);
+    for (const Edge& e : graph.edges[q]) automaton.AddTransition(q, e.symbol, e.to);
+  }
+  automaton.Freeze();
+  std::unique_ptr<p06::AutomatonSimulator> simulator;
+  Distances distances = DistanceToAccept(graph);
+  const bool can_accept = distances.dist[0] != std::numeric_limits<int>::max();
+  const Rejections rejections = RejectionSearch(graph, distances);
+
+  std::ofstream txt(prefix + ".txt");
+  if (!txt) {
+    std::cerr << "No se puede crear fichero: " << prefix << ".txt\n";
+    return 3;
+  }
+  int accepted = 0;
+  for (int i = 0; i < options.num_strings; ++i) {
+    int length = MakeLength(options, strings_rng);
+    std::string word;
+    bool is_accepted = false;
+    if (can_accept && strings_rng.Chance(options.accept_ratio)) {
+      word = MakeAccepted(graph, distances, length, strings_rng);
+      is_accepted = true;
+    } else if (!MakeRejected(graph, rejections, length, strings_rng, word)) {
+      if (!simulator) simulator = std::make_unique<p06::AutomatonSimulator>(automaton);
+      for (int attempt = 0; attempt < kRejectAttempts; ++attempt) {
+        word.clear();
+        for (int j = 0; j < length; ++j) {
+          word += graph.alphabet[strings_rng.Below(graph.alphabet.size())];
+        }
+        is_accepted = simulator->Simulate(word);
+        if (!is_accepted) break;
+      }
+    }
+    if (is_accepted) ++accepted;
+    txt << (word.empty() ? "&" : word) << "\n";
+  }
+  if (!txt) {
+    std::cerr << "Error escribiendo fichero: " << prefix << ".txt\n";
+    return 3;
+  }
+
+  std::cout << "Autómata: " << prefix << ".fa (" << options.num_states << " estados, "
+            << automaton.GetNumTransitions() << " transiciones)\n"
+            << "Cadenas: " << prefix << ".txt (" << accepted << " aceptadas, "
+            << options.num_strings - accepted << " rechazadas)\n";
+  return 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: lazy_dfa_simulator.cc: implementación de la clase LazyDfaSimulator.
+ *    Contiene la construcción de subconjuntos bajo demanda y la gestión de la
+ *    caché de estados del DFA.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Validación del alfabeto dentro del bucle de simulación
+ *    16/10/2026 - Conjunto sucesor en SimulatorScratch
+ *    16/10/2026 - Sucesor con EpsilonClosureTable::Step
+*/
+
+/**
+ * @file lazy_dfa_simulator.cc
+ * @brief Implementación del simulador DFA perezoso.
+ */
+
+#include "lazy_dfa_simulator.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace p06 {
+
+// Memoria estimada por entrada de la caché además de sus datos (nodo del mapa)
+static constexpr std::size_t kEntryOverhead = 64;
+
+/**
+ * @brief Constructor: precalcula los cierres por & y deja la caché vacía.
+ */
+LazyDfaSimulator::LazyDfaSimulator(const Automaton& automaton,
+                                   std::size_t max_cache_bytes)
+    : automaton_(automaton),
+      closure_table_(automaton),
+      max_cache_bytes_(max_cache_bytes),
+      num_classes_(static_cast<std::size_t>(automaton.GetNumClasses())),
+      cache_bytes_(0),
+      num_flushes_(0),
+      start_(-1) {
+  scratch_.Prepare(automaton.GetNumStates());
+}
+
+/**
+ * @brief Calcula en scratch_.next el sucesor (ya cerrado por &) de un conjunto.
+ */
+void LazyDfaSimulator::ComputeSuccessor(const StateVector& states,
+                                        int class_id) {
+  closure_table_.Step(states, class_id, scratch_);
+  std::sort(scratch_.next.begin(), scratch_.next.end());
+}
+
+/**
+ * @brief Busca un conjunto en la caché o lo registra como nuevo estado DFA.
+ *
+ * @return Identificador del estado DFA, o -1 si no cabe en la caché (la
+ *         caché vacía siempre admite al menos un estado)
+ */
+int LazyDfaSimulator::Intern(const StateVector& states) {
+  auto it = ids_.find(states);
+  if (it != ids_.end()) return it->second;
+
+  std::size_t bytes = states.size() * sizeof(Automaton::State) +
+                      num_classes_ * sizeof(int) + kEntryOverhead;
+  if (!sets_.empty() && cache_bytes_ + bytes > max_cache_bytes_) return -1;
+
+  int id = static_cast<int>(sets_.size());
+  it = ids_.emplace(states, id).first;
+  sets_.push_back(&it->first);
+  bool accepting = false;
+  for (auto s : states) {
+    if (automaton_.IsAcceptingState(s)) {
+      accepting = true;
+      break;
+    }
+  }
+  accepting_.push_back(accepting ? 1 : 0);
+  transitions_.resize(transitions_.size() + num_classes_, kUnknown);
+  cache_bytes_ += bytes;
+  return id;
+}
+
+/**
+ * @brief Vacía la caché por completo (incluido el estado inicial).
+ */
+void LazyDfaSimulator::Flush() {
+  ids_.clear();
+  sets_.clear();
+  accepting_.clear();
+  transitions_.clear();
+  cache_bytes_ = 0;
+  start_ = -1;
+  ++num_flushes_;
+}
+
+/**
+ * @brief Devuelve el estado DFA inicial, registrándolo si no está en caché.
+ */
+int LazyDfaSimulator::GetStartState() {
+  if (start_ >= 0) return start_;
+  scratch_.BeginSet();
+  closure_table_.AppendClosure(automaton_.GetStartState(), scratch_);
+  std::sort(scratch_.next.begin(), scratch_.next.end());
+  start_ = Intern(scratch_.next);
+  if (start_ < 0) {
+    Flush();
+    start_ = Intern(scratch_.next);
+  }
+  return start_;
+}
+
+/**
+ * @brief Simula la cadena sobre el DFA perezoso.
+ *
+ * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+ * @return true si la cadena es aceptada, false si es rechazada
+ */
+bool LazyDfaSimulator::Simulate(std::string_view input) {
+  const Automaton::ClassTable& class_of = automaton_.GetClassTable();
+  const std::size_t flushes_before = num_flushes_;
+  int current = GetStartState();
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    int class_id = class_of[static_cast<unsigned char>(input[i])];
+    if (class_id == Automaton::kNoClass) return false;  // fuera del alfabeto
+    std::size_t cell = static_cast<std::size_t>(current) * num_classes_ +
+                       static_cast<std::size_t>(class_id);
+    int next = transitions_[cell];
+    if (next == kUnknown) {
+      // Transición no calculada: construimos el subconjunto sucesor
+      ComputeSuccessor(*sets_[current], class_id);
+      if (scratch_.next.empty()) {
+        next = kDead;
+      } else {
+        next = Intern(scratch_.next);
+        if (next < 0) {
+          // Caché llena: vaciamos, salvo que esta cadena ya lo haya hecho
+          // demasiadas veces; en ese caso seguimos sobre el NFA
+          if (num_flushes_ - flushes_before >= kMaxFlushesPerString) {
+            return SimulateNfa(scratch_.next, input, i + 1);
+          }
+          Flush();
+          current = Intern(scratch_.next);
+          continue;
+        }
+      }
+      transitions_[cell] = next;
+    }
+    if (next == kDead) return false;  // no quedan estados activos
+    current = next;
+  }
+  return accepting_[current] != 0;
+}
+
+/**
+ * @brief Simula el NFA paso a paso, sin caché, desde la posición pos.
+ *
+ * @param states Conjunto actual (cerrado por &)
+ * @param input Cadena completa
+ * @param pos Primera posición aún no consumida
+ */
+bool LazyDfaSimulator::SimulateNfa(StateVector states, std::string_view input,
+                                   std::size_t pos) {
+  for (std::size_t i = pos; i < input.size(); ++i) {
+    int class_id = automaton_.GetClass(input[i]);
+    if (class_id == Automaton::kNoClass) return false;  // fuera del alfabeto
+    ComputeSuccessor(states, class_id);
+    if (scratch_.next.empty()) return false;
+    states.swap(scratch_.next);
+  }
+  for (auto s : states) {
+    if (automaton_.IsAcceptingState(s)) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Devuelve el número de estados DFA en caché.
+ */
+std::size_t LazyDfaSimulator::GetNumCachedStates() const {
+  return sets_.size();
+}
+
+/**
+ * @brief Devuelve la memoria estimada de la caché (bytes).
+ */
+std::size_t LazyDfaSimulator::GetCacheBytes() const {
+  return cache_bytes_;
+}
+
+/**
+ * @brief Devuelve el número de vaciados de la caché.
+ */
+std::size_t LazyDfaSimulator::GetNumFlushes() const {
+  return num_flushes_;
+}
+
+}
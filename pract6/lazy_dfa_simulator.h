@@ -0,0 +1,119 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: lazy_dfa_simulator.h: interfaz de la clase LazyDfaSimulator.
+ *    Contiene la definición de un simulador que construye el DFA equivalente
+ *    bajo demanda (construcción de subconjuntos perezosa) con caché acotada.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Simulate recibe std::string_view (sin copias de la cadena)
+ *    16/10/2026 - Conjunto sucesor en SimulatorScratch
+*/
+
+/**
+ * @file lazy_dfa_simulator.h
+ * @brief Interfaz del simulador DFA perezoso.
+ *
+ * Cada conjunto de estados del NFA que aparece durante la simulación se
+ * registra como un estado del DFA y sus transiciones se guardan en caché.
+ * Tras el calentamiento, cada símbolo cuesta una consulta a la tabla.
+ */
+
+#ifndef P06_SIMULATOR_LAZY_DFA_SIMULATOR_H_
+#define P06_SIMULATOR_LAZY_DFA_SIMULATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "automata.h"
+#include "epsilon_closure.h"
+#include "simulator_scratch.h"
+
+namespace p06 {
+
+/**
+ * @brief Simulador con construcción de subconjuntos bajo demanda.
+ *
+ * La caché tiene un límite de memoria aproximado. Al alcanzarlo se vacía por
+ * completo y se sigue desde el conjunto actual; si una misma cadena provoca
+ * demasiados vaciados (autómatas patológicos), el resto de esa cadena se
+ * simula paso a paso sobre el NFA sin caché.
+ *
+ * A diferencia de los otros simuladores, Simulate no es const: modifica la
+ * caché. Cada hilo debe usar su propia instancia.
+ */
+class LazyDfaSimulator {
+ public:
+  // Límite de memoria por defecto de la caché (bytes)
+  static constexpr std::size_t kDefaultCacheBytes = std::size_t{64} << 20;
+  // Vaciados por cadena a partir de los cuales se pasa a simular el NFA
+  static constexpr std::size_t kMaxFlushesPerString = 4;
+
+  /**
+   * @brief Construye el simulador sobre un autómata congelado.
+   * @param automaton Autómata a simular
+   * @param max_cache_bytes Límite aproximado de memoria de la caché
+   */
+  explicit LazyDfaSimulator(const Automaton& automaton,
+                            std::size_t max_cache_bytes = kDefaultCacheBytes);
+
+  /**
+   * @brief Simula la cadena dada, ampliando la caché si hace falta.
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @return true si la cadena es aceptada, false si es rechazada
+   */
+  bool Simulate(std::string_view input);
+
+  std::size_t GetNumCachedStates() const; // Estados del DFA en caché
+  std::size_t GetCacheBytes() const; // Memoria estimada de la caché
+  std::size_t GetNumFlushes() const; // Veces que se ha vaciado la caché
+
+ private:
+  using StateVector = Automaton::StateVector;
+
+  // Valores especiales en la tabla de transiciones
+  static constexpr int kUnknown = -2; // Transición aún no calculada
+  static constexpr int kDead = -1; // Conjunto vacío: la cadena se rechaza
+
+  int GetStartState(); // Estado DFA inicial (lo registra si hace falta)
+  int Intern(const StateVector& states); // Registra (o busca) un conjunto
+  void Flush(); // Vacía la caché por completo
+  // Calcula en scratch_.next el conjunto sucesor de (conjunto, símbolo), ordenado
+  void ComputeSuccessor(const StateVector& states, int class_id);
+  // Simula el NFA sin caché desde states a partir de la posición pos
+  bool SimulateNfa(StateVector states, std::string_view input, std::size_t pos);
+
+  const Automaton& automaton_; // Referencia al autómata a simular
+  EpsilonClosureTable closure_table_; // Cierre por & de cada estado
+  std::size_t max_cache_bytes_; // Límite de memoria de la caché
+  std::size_t num_classes_; // Columnas de la tabla de transiciones
+
+  // Caché: conjunto de estados NFA -> identificador de estado DFA
+  std::unordered_map<StateVector, int, Automaton::StateVectorHash> ids_;
+  std::vector<const StateVector*> sets_; // Conjunto de cada estado DFA
+  std::vector<std::uint8_t> accepting_; // Aceptación de cada estado DFA
+  std::vector<int> transitions_; // Tabla [estado DFA][símbolo]
+  std::size_t cache_bytes_; // Memoria estimada en uso
+  std::size_t num_flushes_; // Número de vaciados
+  int start_; // Estado DFA inicial (-1 si no está en caché)
+
+  // Memoria de trabajo reutilizada entre pasos
+  SimulatorScratch scratch_; // Conjunto sucesor en construcción (scratch_.next)
+};
+
+}
+
+#endif
@@ -18,6 +18,22 @@
  * Historial de revisiones
  *    19/10/2025 - Creación (primera versión) del código
  *    19/10/2025 - Documentación y comentarios
+ *    16/10/2026 - Opción --engine para elegir el motor de simulación
+ *    16/10/2026 - Motor lazy-dfa y opción --cache-mb
+ *    16/10/2026 - Modo --determinize, motor dfa y carga de ficheros .dfa
+ *    16/10/2026 - Opción --minimize (minimización del DFA)
+ *    16/10/2026 - Motor shift-and y selección automática de motor (auto)
+ *    16/10/2026 - Opción --threads (simulación en paralelo con salida ordenada)
+ *    16/10/2026 - Fichero de cadenas proyectado en memoria y líneas como string_view
+ *    16/10/2026 - Modo --stream (entrada estándar o fichero completo como una cadena)
+ *    16/10/2026 - --stream en paralelo por bloques sobre el DFA (--threads)
+ *    16/10/2026 - Formato binario .fab: modo --compile y carga proyectada
+ *    16/10/2026 - Modo --emit-cpp (reconocedor C++ generado y su prueba)
+ *    16/10/2026 - Motor jit (DFA traducido a código x86-64)
+ *    16/10/2026 - Opción --stats (contadores del motor nfa en JSON)
+ *    16/10/2026 - Opción --verify (verificación completa de un .fab)
+ *    16/10/2026 - El simulador nfa solo se construye si se usa
+ *    16/10/2026 - --minimize rechazado con motores que no simulan un DFA
 */
 
 /**
@@ -25,20 +41,51 @@
  * @brief Programa principal: usa FAParser, Automaton y AutomatonSimulator.
  *
  * Uso:
- *  ./p06_automata_simulator input.fa input.txt
+ *  ./p06_automata_simulator input.fa input.txt [--engine nombre] [--cache-mb N] [--threads N]
+ *                           [--stats] [--verify]
+ *  ./p06_automata_simulator automata.dfa input.txt [--minimize]
+ *  ./p06_automata_simulator --determinize input.fa salida.dfa [--max-dfa-states N] [--minimize]
+ *  ./p06_automata_simulator --compile input.fa salida.fab
+ *  ./p06_automata_simulator --emit-cpp input.fa salida.h [--name id] [--minimize]
+ *                           [--max-dfa-states N] [--test input.txt prueba.cc]
+ *  ./p06_automata_simulator --stream input.fa|automata.dfa [fichero] [--threads N]
+ *                           [--max-dfa-states N]
  *
  * Si se ejecuta sin argumentos, muestra un mensaje de uso.
  */
 
 #include <algorithm>
 #include <cctype>
-#include <fstream>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
 #include <iostream>
-#include <sstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #include "automata_simulator.h"
+#include "bitset_simulator.h"
+#include "chunked_dfa_simulator.h"
+#include "cpp_emitter.h"
+#include "dfa.h"
+#include "dfa_jit.h"
+#include "dfa_minimizer.h"
+#include "fab_file.h"
 #include "fa_parser.h"
+#include "lazy_dfa_simulator.h"
+#include "mapped_file.h"
+#include "shift_and_simulator.h"
+#include "simulation_session.h"
+#include "simulator_stats.h"
+#include "work_stealing_pool.h"
 
 /**
  * @brief Imprime una línea corta de uso cuando faltan argumentos.
@@ -46,7 +93,11 @@
  * Se usa cuando el usuario ejecuta el programa sin la sintaxis correcta.
  */
 static void PrintUsage() {
-  std::cout << "Modo de empleo: ./p06_automata_simulator input.fa input.txt\n"
+  std::cout << "Modo de empleo: ./p06_automata_simulator input.fa input.txt [opciones]\n"
+            << "               ./p06_automata_simulator --determinize input.fa salida.dfa\n"
+            << "               ./p06_automata_simulator --compile input.fa salida.fab\n"
+            << "               ./p06_automata_simulator --emit-cpp input.fa salida.h\n"
+            << "               ./p06_automata_simulator --stream input.fa [fichero]\n"
             << "Pruebe 'p06_automata_simulator --help' para más información.\n";
 }
 
@@ -58,7 +109,43 @@ static void PrintUsage() {
 static void PrintHelp() {
   std::cout << "p06_automata_simulator - Simulador de autómatas finitos (NFA)\n\n"
             << "Uso:\n"
-            << "  ./p06_automata_simulator input.fa input.txt\n\n"
+            << "  ./p06_automata_simulator input.fa input.txt [opciones]\n"
+            << "  ./p06_automata_simulator automata.dfa input.txt [--minimize]\n"
+            << "  ./p06_automata_simulator --determinize input.fa salida.dfa [--max-dfa-states N]\n"
+            << "                           [--minimize]\n"
+            << "  ./p06_automata_simulator --compile input.fa salida.fab\n"
+            << "  ./p06_automata_simulator --emit-cpp input.fa salida.h [--name id] [--minimize]\n"
+            << "                           [--max-dfa-states N] [--test input.txt prueba.cc]\n"
+            << "  ./p06_automata_simulator --stream input.fa|automata.dfa [fichero] [--threads N]\n"
+            << "                           [--max-dfa-states N]\n\n"
+            << "Opciones:\n"
+            << "  --engine nombre      Motor de simulación (por defecto auto):\n"
+            << "                         auto, nfa, shift-and, bitset, lazy-dfa, dfa, jit\n"
+            << "                         (auto usa shift-and hasta 64 estados y nfa si no;\n"
+            << "                         jit traduce el DFA a x86-64 o, si no puede, usa dfa)\n"
+            << "  --cache-mb N         Límite de la caché del motor lazy-dfa (MB, por hilo)\n"
+            << "  --threads N          Hilos de simulación (0 = uno por núcleo; por defecto 1)\n"
+            << "  --max-dfa-states N   Límite de estados al determinizar (motor dfa)\n"
+            << "  --minimize           Minimiza el DFA antes de simularlo o guardarlo\n"
+            << "                       (al simular, solo con los motores dfa y jit)\n"
+            << "  --stats              Escribe en stderr los contadores del motor nfa (JSON)\n"
+            << "  --verify             Verifica por completo un .fab al cargarlo (suma de\n"
+            << "                       comprobación y destinos; por defecto solo la cabecera)\n\n"
+            << "Un fichero .dfa (generado con --determinize) se simula directamente\n"
+            << "con el motor dfa, sin volver a determinizar.\n\n"
+            << "--compile guarda el autómata en el formato binario .fab, que se carga\n"
+            << "proyectado en memoria (sin parseo) allí donde se admite un .fa. El\n"
+            << "fichero se verifica por completo al escribirlo; al cargarlo solo se\n"
+            << "comprueba la cabecera, salvo con --verify.\n\n"
+            << "--emit-cpp determiniza el autómata y escribe una cabecera autónoma con\n"
+            << "id::Match(std::string_view) en código switch/goto (id por defecto\n"
+            << "p06_matcher). Con --test genera además un programa que comprueba Match\n"
+            << "con los veredictos del simulador NFA sobre las cadenas de input.txt.\n\n"
+            << "Con --stream todo el fichero (o la entrada estándar si se omite o es -)\n"
+            << "es una única cadena, salvo un salto de línea final; se lee por trozos\n"
+            << "con memoria constante y se deja de leer en cuanto se rechaza. Con\n"
+            << "--threads N > 1 (o un .dfa) el fichero se proyecta en memoria y se\n"
+            << "simula por bloques en paralelo sobre el DFA.\n\n"
             << "Formato de input.fa: ver especificación de la práctica.\n"
             << "Formato del fichero.txt: una cadena por línea. Usar & para la cadena vacía.\n";
 }
@@ -66,67 +153,542 @@ static void PrintHelp() {
 /**
  * @brief Elimina espacios en ambos extremos de una cadena (trim).
  *
- * Devuelve una copia recortada de s. Usado para normalizar líneas leídas
- * desde ficheros (quitamos \r\n y espacios/tabs alrededor).
+ * Devuelve una vista recortada de s, sin copiarla. Usado para normalizar
+ * líneas leídas desde ficheros (quitamos \r\n y espacios/tabs alrededor).
  */
-static inline std::string Trim(const std::string& s) {
+static inline std::string_view Trim(std::string_view s) {
   size_t a = s.find_first_not_of(" \t\r\n");
-  if (a == std::string::npos) return "";
+  if (a == std::string_view::npos) return std::string_view();
   size_t b = s.find_last_not_of(" \t\r\n");
   return s.substr(a, b - a + 1);
 }
 
+/**
+ * @brief Separadores de tokens (los de operator>> con la configuración "C").
+ */
+static inline bool IsSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
 /**
  * @brief Parsea una línea del fichero de cadenas (input.txt).
  *
- * El fichero de cadenas admite dos formatos (N <cadena> o <cadena>).
+ * El fichero de cadenas admite dos formatos (N <cadena> o <cadena>). Las
+ * salidas son vistas sobre la propia línea: no se copia nada.
  *
  * @param line Línea original leída desde el fichero (puede contener espacios)
  * @param original Salida: la línea original trimmed (para imprimirla luego tal cual)
  * @param tokenized_input Salida: la cadena tokenizada que debe simularse ("" para cadena vacía)
  */
-static void ParseInputLine(const std::string& line,
-                           std::string& original,
-                           std::string& tokenized_input) {
+static void ParseInputLine(std::string_view line,
+                           std::string_view& original,
+                           std::string_view& tokenized_input) {
   // Normalizamos la entrada quitando espacios extremos
   original = Trim(line);
+  tokenized_input = std::string_view();
   if (original.empty()) {
     // Si la línea queda vacía tras trim la interpretamos como cadena vacía
-    tokenized_input.clear();
     return;
   }
 
   // Separamos el primer token para detectar el posible prefijo numérico
-  std::istringstream iss(original);
-  std::string first;
-  if (!(iss >> first)) {
-    // No se pudo extraer ningún token
-    tokenized_input.clear();
+  std::size_t first_begin = 0;
+  while (first_begin < original.size() && IsSpace(original[first_begin])) ++first_begin;
+  if (first_begin == original.size()) {
+    // No hay ningún token
     return;
   }
+  std::size_t first_end = first_begin;
+  while (first_end < original.size() && !IsSpace(original[first_end])) ++first_end;
 
   // Determinamos si el primer token es un número
-  bool first_is_number = !first.empty() &&
-                         std::all_of(first.begin(), first.end(), ::isdigit);
+  bool first_is_number = std::all_of(
+      original.begin() + first_begin, original.begin() + first_end,
+      [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; });
   if (first_is_number) {
-    // Si el primer token es número, intentamos obtener el resto de la línea
-    std::string rest;
-    std::getline(iss, rest); // lee el resto de la línea tal cual
-    rest = Trim(rest);
+    // Si el primer token es número, miramos el resto de la línea
+    std::string_view rest = Trim(original.substr(first_end));
     if (!rest.empty()) {
       // Formato "N <cadena>" entonces usamos el resto como cadena
-      if (rest == "&") tokenized_input.clear(); // & representa cadena vacía
-      else tokenized_input = rest;
+      if (rest != "&") tokenized_input = rest; // & representa cadena vacía
+      return;
+    }
+  }
+  // La línea completa (original) es la cadena
+  if (original != "&") tokenized_input = original;
+}
+
+/**
+ * @brief Recorre las líneas de data (separadas por '\n') llamando a visit.
+ *
+ * Igual que std::getline: un '\n' final no genera una línea vacía extra. El
+ * salto de línea se busca con memchr, que glibc implementa con SIMD.
+ */
+template <typename Visit>
+static void ForEachLine(std::string_view data, Visit visit) {
+  const char* cur = data.data();
+  const char* end = cur + data.size();
+  while (cur < end) {
+    const char* nl = static_cast<const char*>(std::memchr(cur, '\n', end - cur));
+    const char* line_end = nl != nullptr ? nl : end;
+    visit(std::string_view(cur, static_cast<std::size_t>(line_end - cur)));
+    cur = nl != nullptr ? nl + 1 : end;
+  }
+}
+
+/**
+ * @brief Simula las líneas de data y añade "<línea> --- Accepted/Rejected" a out.
+ */
+template <typename Simulate>
+static void SimulateLines(std::string_view data, Simulate& simulate, std::string& out) {
+  ForEachLine(data, [&](std::string_view line) {
+    std::string_view original, input;
+    ParseInputLine(line, original, input);
+    bool accepted = simulate(input);
+    out.append(original.data(), original.size());
+    out += accepted ? " --- Accepted\n" : " --- Rejected\n";
+  });
+}
+
+// Función de simulación de una cadena con el motor elegido
+using SimulateFn = std::function<bool(std::string_view)>;
+
+/**
+ * @brief Simula las cadenas de data en paralelo y escribe los resultados en orden.
+ *
+ * El hilo principal corta data en bloques de unos kChunkBytes bytes (siempre
+ * en un salto de línea, así que pocas cadenas muy largas también se
+ * reparten) y los envía al pool; cada bloque se simula entero en un hilo
+ * (con simulate[hilo]) y su salida se deja en un buffer de reordenación, del
+ * que se escriben los bloques consecutivos por orden. Como mucho hay 4
+ * bloques por hilo en vuelo, lo que acota la memoria.
+ */
+static void RunParallel(std::string_view data, const std::vector<SimulateFn>& simulate,
+                        std::ostream& os) {
+  constexpr std::size_t kChunkBytes = 64 << 10; // Tamaño aproximado de bloque
+  const std::size_t max_in_flight = 4 * simulate.size();
+
+  std::mutex mutex; // Protege ready y next_output
+  std::condition_variable chunk_done; // Aviso de bloque terminado
+  std::map<std::size_t, std::string> ready; // Buffer de reordenación
+  std::size_t next_chunk = 0; // Bloques enviados
+  std::size_t next_output = 0; // Bloques ya escritos
+
+  // Escribe los bloques consecutivos disponibles (sin el mutex al escribir)
+  auto flush_ready = [&](std::unique_lock<std::mutex>& lock) {
+    while (!ready.empty() && ready.begin()->first == next_output) {
+      std::string text = std::move(ready.begin()->second);
+      ready.erase(ready.begin());
+      ++next_output;
+      lock.unlock();
+      os << text;
+      lock.lock();
+    }
+  };
+
+  // El pool se destruye antes que los datos compartidos que usan sus tareas
+  p06::WorkStealingPool pool(static_cast<int>(simulate.size()));
+  std::size_t pos = 0;
+  while (pos < data.size()) {
+    // El bloque termina en el primer salto de línea tras kChunkBytes bytes
+    std::size_t cut = data.size();
+    if (data.size() - pos > kChunkBytes) {
+      std::size_t nl = data.find('\n', pos + kChunkBytes);
+      if (nl != std::string_view::npos) cut = nl + 1;
+    }
+    std::string_view chunk = data.substr(pos, cut - pos);
+    pos = cut;
+
+    std::size_t id = next_chunk++;
+    pool.Submit([&, chunk, id](int worker) {
+      std::string text;
+      text.reserve(chunk.size() + chunk.size() / 2);
+      SimulateLines(chunk, simulate[worker], text);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.emplace(id, std::move(text));
+      }
+      chunk_done.notify_one();
+    });
+
+    // Escribimos lo que ya esté en orden y esperamos si hay demasiados bloques
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      flush_ready(lock);
+      if (next_chunk - next_output < max_in_flight) break;
+      chunk_done.wait(lock);
+    }
+  }
+
+  // Bloques restantes
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    flush_ready(lock);
+    if (next_output == next_chunk) break;
+    chunk_done.wait(lock);
+  }
+}
+
+/**
+ * @brief Convierte un argumento numérico (solo dígitos) a entero sin signo.
+ * @return false si value no es un número válido
+ */
+static bool ParseCount(const std::string& value, std::size_t& out) {
+  if (value.empty() || value.size() > 18 ||
+      !std::all_of(value.begin(), value.end(), ::isdigit)) {
+    return false;
+  }
+  out = static_cast<std::size_t>(std::stoull(value));
+  return true;
+}
+
+/**
+ * @brief true si filename termina en la extensión dada (por ejemplo ".dfa").
+ */
+static bool HasExtension(const std::string& filename, const std::string& ext) {
+  return filename.size() >= ext.size() &&
+         filename.compare(filename.size() - ext.size(), ext.size(), ext) == 0;
+}
+
+/**
+ * @brief Carga un autómata de un .fab (proyectado) o de un .fa (FAParser).
+ * @param verify Verificación completa de un .fab (ver FabFile::Load)
+ * @return false si la carga falla; err describe el problema
+ */
+static bool LoadAutomaton(const std::string& filename, p06::Automaton& automaton,
+                          std::string& err, bool verify = false) {
+  if (HasExtension(filename, ".fab")) {
+    return p06::FabFile::Load(filename, automaton, err, verify);
+  }
+  p06::FAParser parser;
+  return parser.ParseFile(filename, automaton, err);
+}
+
+/**
+ * @brief Sustituye el DFA por su mínimo e informa de los estados antes y después.
+ */
+static void MinimizeDfa(p06::Dfa& dfa, std::ostream& os) {
+  auto begin = std::chrono::steady_clock::now();
+  int before = dfa.GetNumStates();
+  dfa = p06::DfaMinimizer::Minimize(dfa);
+  auto end = std::chrono::steady_clock::now();
+  double ms = std::chrono::duration<double, std::milli>(end - begin).count();
+  os << "Minimización del DFA: " << before << " -> " << dfa.GetNumStates()
+     << " estados (" << ms << " ms)\n";
+}
+
+/**
+ * @brief Modo herramienta --determinize: .fa -> .dfa.
+ *
+ * Parsea el .fa, ejecuta la construcción de subconjuntos completa (y, con
+ * --minimize, la minimización) y escribe el DFA resultante. Informa del
+ * número de estados y del tiempo empleado.
+ */
+static int RunDeterminize(int argc, char* argv[]) {
+  if (argc < 4) {
+    PrintUsage();
+    return 1;
+  }
+  std::string fa_file = argv[2];
+  std::string dfa_file = argv[3];
+  std::size_t max_states = p06::Dfa::kDefaultMaxStates;
+  bool minimize = false;
+  for (int i = 4; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (opt == "--max-dfa-states" && i + 1 < argc) {
+      if (!ParseCount(argv[++i], max_states)) {
+        std::cerr << "Valor de --max-dfa-states inválido: " << argv[i] << "\n";
+        return 1;
+      }
+    } else if (opt == "--minimize") {
+      minimize = true;
+    } else {
+      std::cerr << "Opción desconocida: " << opt << "\n";
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  p06::Automaton automaton;
+  std::string err;
+  if (!LoadAutomaton(fa_file, automaton, err)) {
+    std::cerr << "Error al crear el autómata: " << err << "\n";
+    return 2;
+  }
+
+  // Construcción de subconjuntos cronometrada
+  auto begin = std::chrono::steady_clock::now();
+  p06::Dfa dfa;
+  if (!p06::Dfa::Determinize(automaton, max_states, dfa, err)) {
+    std::cerr << "Error al determinizar: " << err << "\n";
+    return 4;
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ms = std::chrono::duration<double, std::milli>(end - begin).count();
+  std::cout << "Estados del NFA: " << automaton.GetNumStates() << "\n"
+            << "Estados del DFA: " << dfa.GetNumStates() << "\n"
+            << "Tiempo de construcción: " << ms << " ms\n";
+  if (minimize) MinimizeDfa(dfa, std::cout);
+
+  if (!dfa.WriteFile(dfa_file, err)) {
+    std::cerr << err << "\n";
+    return 3;
+  }
+  return 0;
+}
+
+/**
+ * @brief Modo herramienta --compile: .fa -> .fab.
+ *
+ * Parsea el .fa una vez y guarda el autómata congelado en formato binario;
+ * informa del tamaño y del tiempo de parseo que se ahorra en cada carga.
+ * Después vuelve a cargar el .fab con la verificación completa.
+ */
+static int RunCompile(int argc, char* argv[]) {
+  if (argc != 4) {
+    PrintUsage();
+    return 1;
+  }
+  std::string fa_file = argv[2];
+  std::string fab_file = argv[3];
+
+  auto begin = std::chrono::steady_clock::now();
+  p06::Automaton automaton;
+  std::string err;
+  if (!LoadAutomaton(fa_file, automaton, err)) {
+    std::cerr << "Error al crear el autómata: " << err << "\n";
+    return 2;
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ms = std::chrono::duration<double, std::milli>(end - begin).count();
+  std::cout << "Estados: " << automaton.GetNumStates() << "\n"
+            << "Transiciones: " << automaton.GetNumTransitions() << "\n"
+            << "Tiempo de parseo: " << ms << " ms\n";
+
+  if (!p06::FabFile::Write(automaton, fab_file, err)) {
+    std::cerr << err << "\n";
+    return 3;
+  }
+
+  // Verificación completa, una sola vez, del fichero tal como quedó escrito:
+  // las cargas posteriores solo comprueban la cabecera
+  p06::Automaton written;
+  if (!p06::FabFile::Load(fab_file, written, err, true)) {
+    std::cerr << "Error al verificar " << fab_file << ": " << err << "\n";
+    return 3;
+  }
+  return 0;
+}
+
+/**
+ * @brief Modo herramienta --emit-cpp: .fa -> cabecera C++ (y prueba opcional).
+ *
+ * Determiniza (y, con --minimize, minimiza) el autómata y escribe el
+ * reconocedor con CppEmitter. Con --test, simula cada cadena del fichero con
+ * AutomatonSimulator y escribe un programa que compara esos veredictos con
+ * los del reconocedor generado (incluye la cabecera por su nombre, así que
+ * ambos ficheros deben compilarse en el mismo directorio).
+ */
+static int RunEmitCpp(int argc, char* argv[]) {
+  if (argc < 4) {
+    PrintUsage();
+    return 1;
+  }
+  std::string fa_file = argv[2];
+  std::string header_file = argv[3];
+  std::string name = "p06_matcher";
+  std::string txt_file;
+  std::string test_file;
+  std::size_t max_states = p06::Dfa::kDefaultMaxStates;
+  bool minimize = false;
+  for (int i = 4; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (opt == "--max-dfa-states" && i + 1 < argc) {
+      if (!ParseCount(argv[++i], max_states)) {
+        std::cerr << "Valor de --max-dfa-states inválido: " << argv[i] << "\n";
+        return 1;
+      }
+    } else if (opt == "--minimize") {
+      minimize = true;
+    } else if (opt == "--name" && i + 1 < argc) {
+      name = argv[++i];
+      if (!p06::CppEmitter::IsValidName(name)) {
+        std::cerr << "Valor de --name inválido (debe ser un identificador C++): " << name
+                  << "\n";
+        return 1;
+      }
+    } else if (opt == "--test" && i + 2 < argc) {
+      txt_file = argv[++i];
+      test_file = argv[++i];
     } else {
-      // La línea es solo numérica, la tratamos como cadena literal
-      if (original == "&") tokenized_input.clear();
-      else tokenized_input = original;
+      std::cerr << "Opción desconocida: " << opt << "\n";
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  p06::Automaton automaton;
+  std::string err;
+  if (!LoadAutomaton(fa_file, automaton, err)) {
+    std::cerr << "Error al crear el autómata: " << err << "\n";
+    return 2;
+  }
+  p06::Dfa dfa;
+  if (!p06::Dfa::Determinize(automaton, max_states, dfa, err)) {
+    std::cerr << "Error al determinizar: " << err << "\n";
+    return 4;
+  }
+  std::cout << "Estados del DFA: " << dfa.GetNumStates() << "\n";
+  if (minimize) MinimizeDfa(dfa, std::cout);
+
+  if (!p06::CppEmitter::WriteMatcher(dfa, name, fa_file, header_file, err)) {
+    std::cerr << err << "\n";
+    return 3;
+  }
+  if (test_file.empty()) return 0;
+
+  // Veredictos de referencia del simulador NFA
+  p06::MappedFile strings_file;
+  if (!strings_file.Open(txt_file, err)) {
+    std::cerr << "No se puede abrir fichero de cadenas: " << txt_file << "\n";
+    return 3;
+  }
+  p06::AutomatonSimulator simulator(automaton);
+  std::vector<p06::CppEmitter::TestCase> cases;
+  ForEachLine(strings_file.GetData(), [&](std::string_view line) {
+    std::string_view original, input;
+    ParseInputLine(line, original, input);
+    cases.push_back({std::string(input), simulator.Simulate(input)});
+  });
+  std::string header_name = header_file.substr(header_file.find_last_of('/') + 1);
+  if (!p06::CppEmitter::WriteTest(name, header_name, cases, test_file, err)) {
+    std::cerr << err << "\n";
+    return 3;
+  }
+  std::cout << "Prueba: " << cases.size() << " cadenas en " << test_file << "\n";
+  return 0;
+}
+
+/**
+ * @brief Simula la cadena de in (stdin o fichero) por trozos con SimulationSession.
+ *
+ * Lee la entrada por bloques de kBlockBytes bytes, así que la memoria no
+ * depende del tamaño de la cadena. El '\n' con el que acaba un bloque se
+ * retiene hasta saber si hay más datos (un '\n' final no forma parte de la
+ * cadena). La lectura se interrumpe en cuanto la sesión muere.
+ *
+ * @return false si falla la lectura
+ */
+static bool StreamSequential(const p06::Automaton& automaton, std::FILE* in,
+                             std::uint64_t& consumed, bool& accepted) {
+  p06::AutomatonSimulator simulator(automaton);
+  p06::SimulationSession session(simulator);
+  constexpr std::size_t kBlockBytes = 64 << 10;
+  std::vector<char> block(kBlockBytes);
+  bool held_newline = false; // '\n' final del bloque anterior, aún sin consumir
+  while (!session.IsDead()) {
+    std::size_t size = std::fread(block.data(), 1, block.size(), in);
+    if (size == 0) {
+      if (std::ferror(in) != 0) return false;
+      break;
     }
+    if (held_newline) session.Feed("\n", 1);
+    held_newline = block[size - 1] == '\n';
+    session.Feed(block.data(), held_newline ? size - 1 : size);
+  }
+  consumed = session.GetConsumed();
+  accepted = session.IsAccepting();
+  return true;
+}
+
+/**
+ * @brief Modo --stream: el fichero completo (o stdin) es una única cadena.
+ *
+ * Con un solo hilo la cadena se lee por trozos (StreamSequential). Con
+ * --threads N > 1 y un fichero, el fichero se proyecta en memoria y se
+ * simula por bloques en paralelo sobre el DFA (ChunkedDfaSimulator), que se
+ * determiniza aquí o se carga si el autómata es un fichero .dfa.
+ */
+static int RunStream(int argc, char* argv[]) {
+  if (argc < 3) {
+    PrintUsage();
+    return 1;
+  }
+  std::string fa_file = argv[2];
+  std::string word_file = "-";
+  int first_option = 3;
+  if (argc > 3 && std::string(argv[3]).compare(0, 2, "--") != 0) {
+    word_file = argv[3];
+    first_option = 4;
+  }
+  std::size_t num_threads = 1;
+  std::size_t max_dfa_states = p06::Dfa::kDefaultMaxStates;
+  for (int i = first_option; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (opt == "--threads" && i + 1 < argc) {
+      if (!ParseCount(argv[++i], num_threads) || num_threads > 1024) {
+        std::cerr << "Valor de --threads inválido: " << argv[i] << "\n";
+        return 1;
+      }
+      if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    } else if (opt == "--max-dfa-states" && i + 1 < argc) {
+      if (!ParseCount(argv[++i], max_dfa_states)) {
+        std::cerr << "Valor de --max-dfa-states inválido: " << argv[i] << "\n";
+        return 1;
+      }
+    } else {
+      std::cerr << "Opción desconocida: " << opt << "\n";
+      PrintUsage();
+      return 1;
+    }
+  }
+  // Una tubería no se puede partir en bloques sin leerla entera
+  bool chunked = HasExtension(fa_file, ".dfa") || (num_threads > 1 && word_file != "-");
+
+  p06::Automaton automaton;
+  p06::Dfa dfa;
+  std::string err;
+  if (HasExtension(fa_file, ".dfa")) {
+    if (!dfa.ReadFile(fa_file, err)) {
+      std::cerr << "Error al cargar el DFA: " << err << "\n";
+      return 2;
+    }
+  } else if (!LoadAutomaton(fa_file, automaton, err)) {
+    std::cerr << "Error al crear el autómata: " << err << "\n";
+    return 2;
+  } else if (chunked && !p06::Dfa::Determinize(automaton, max_dfa_states, dfa, err)) {
+    std::cerr << "Error al determinizar: " << err << "\n";
+    return 4;
+  }
+
+  std::uint64_t consumed = 0;
+  bool accepted = false;
+  if (chunked) {
+    p06::MappedFile word;
+    if (!word.Open(word_file == "-" ? "/dev/stdin" : word_file, err)) {
+      std::cerr << "No se puede abrir fichero de cadenas: " << word_file << "\n";
+      return 3;
+    }
+    std::string_view input = word.GetData();
+    if (!input.empty() && input.back() == '\n') input.remove_suffix(1);
+    p06::ChunkedDfaSimulator simulator(dfa, static_cast<int>(num_threads));
+    accepted = simulator.Simulate(input, consumed);
   } else {
-    // El primer token no es un número: la línea completa (original) es la cadena.
-    if (original == "&") tokenized_input.clear();
-    else tokenized_input = original;
+    std::FILE* in = word_file == "-" ? stdin : std::fopen(word_file.c_str(), "rb");
+    if (in == nullptr) {
+      std::cerr << "No se puede abrir fichero de cadenas: " << word_file << "\n";
+      return 3;
+    }
+    bool read_ok = StreamSequential(automaton, in, consumed, accepted);
+    if (in != stdin) std::fclose(in);
+    if (!read_ok) {
+      std::cerr << "Error leyendo fichero de cadenas: " << word_file << "\n";
+      return 3;
+    }
   }
+
+  std::cout << consumed << " símbolos --- " << (accepted ? "Accepted" : "Rejected") << "\n";
+  return 0;
 }
 
 /**
@@ -154,48 +716,225 @@ int main(int argc, char* argv[]) {
     PrintUsage();
     return 1;
   }
-  if (argc != 3) {
-    PrintUsage();
-    return 1;
-  }
+  if (std::string(argv[1]) == "--determinize") return RunDeterminize(argc, argv);
+  if (std::string(argv[1]) == "--stream") return RunStream(argc, argv);
+  if (std::string(argv[1]) == "--compile") return RunCompile(argc, argv);
+  if (std::string(argv[1]) == "--emit-cpp") return RunEmitCpp(argc, argv);
 
   // Guardamos las rutas de ficheros recibidas por línea de comandos
   std::string fa_file = argv[1];
   std::string txt_file = argv[2];
 
-  // Creamos las estructuras principales, el autómata y el parser
+  // Opciones a partir del tercer argumento
+  std::string engine = "auto";
+  std::size_t cache_mb = p06::LazyDfaSimulator::kDefaultCacheBytes >> 20;
+  std::size_t max_dfa_states = p06::Dfa::kDefaultMaxStates;
+  bool minimize = false;
+  bool stats = false;
+  bool verify = false;
+  std::size_t num_threads = 1;
+  for (int i = 3; i < argc; ++i) {
+    std::string opt = argv[i];
+    if (opt == "--engine" && i + 1 < argc) {
+      engine = argv[++i];
+    } else if (opt == "--cache-mb" && i + 1 < argc) {
+      if (!ParseCount(argv[++i], cache_mb)) {
+        std::cerr << "Valor de --cache-mb inválido: " << argv[i] << "\n";
+        return 1;
+      }
+    } else if (opt == "--max-dfa-states" && i + 1 < argc) {
+      if (!ParseCount(argv[++i], max_dfa_states)) {
+        std::cerr << "Valor de --max-dfa-states inválido: " << argv[i] << "\n";
+        return 1;
+      }
+    } else if (opt == "--minimize") {
+      minimize = true;
+    } else if (opt == "--stats") {
+      stats = true;
+    } else if (opt == "--verify") {
+      verify = true;
+    } else if (opt == "--threads" && i + 1 < argc) {
+      if (!ParseCount(argv[++i], num_threads) || num_threads > 1024) {
+        std::cerr << "Valor de --threads inválido: " << argv[i] << "\n";
+        return 1;
+      }
+      if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    } else {
+      std::cerr << "Opción desconocida: " << opt << "\n";
+      PrintUsage();
+      return 1;
+    }
+  }
+  if (engine != "auto" && engine != "nfa" && engine != "shift-and" &&
+      engine != "bitset" && engine != "lazy-dfa" && engine != "dfa" &&
+      engine != "jit") {
+    std::cerr << "Motor desconocido: " << engine << "\n";
+    PrintUsage();
+    return 1;
+  }
+  // Los contadores son los del simulador NFA
+  if (stats && engine == "auto") engine = "nfa";
+  if (stats && (engine != "nfa" || HasExtension(fa_file, ".dfa"))) {
+    std::cerr << "--stats solo está disponible con el motor nfa\n";
+    return 1;
+  }
+  // Solo dfa y jit simulan un DFA (un .dfa siempre se simula con uno de ellos)
+  if (minimize && engine != "dfa" && engine != "jit" && !HasExtension(fa_file, ".dfa")) {
+    std::cerr << "--minimize solo está disponible con los motores dfa y jit\n";
+    return 1;
+  }
+
+  // Creamos las estructuras principales, el autómata y el DFA
   p06::Automaton automaton;
-  p06::FAParser parser;
+  p06::Dfa dfa;
   std::string err;
 
-  // Parseo y validación del fichero .fa
-  if (!parser.ParseFile(fa_file, automaton, err)) {
+  if (HasExtension(fa_file, ".dfa")) {
+    // DFA ya determinizado: se carga y se simula directamente
+    if (!dfa.ReadFile(fa_file, err)) {
+      std::cerr << "Error al cargar el DFA: " << err << "\n";
+      return 2;
+    }
+    if (engine != "jit") engine = "dfa";
+  } else if (!LoadAutomaton(fa_file, automaton, err, verify)) {
+    // Parseo y validación del fichero .fa
     std::cerr << "Error al crear el autómata: " << err << "\n";
     // Salimos con código de error distinto de 0 para indicar fallo en la carga
     return 2;
+  } else if ((engine == "dfa" || engine == "jit") &&
+             !p06::Dfa::Determinize(automaton, max_dfa_states, dfa, err)) {
+    std::cerr << "Error al determinizar: " << err << "\n";
+    return 4;
   }
+  // La salida estándar queda reservada a los veredictos
+  if ((engine == "dfa" || engine == "jit") && minimize) MinimizeDfa(dfa, std::cerr);
 
-  // Creamos el simulador con el autómata ya validado
-  p06::AutomatonSimulator simulator(automaton);
+  // Selección automática: Shift-And si el conjunto de estados cabe en 64 bits
+  if (engine == "auto") {
+    engine = p06::ShiftAndSimulator::Supports(automaton) ? "shift-and" : "nfa";
+  }
 
-  // Abrimos el fichero de cadenas (input.txt)
-  std::ifstream ifs(txt_file);
-  if (!ifs) {
+  // Creamos solo el simulador elegido, con el autómata ya validado (el de
+  // nfa construye la tabla de cierres, así que tampoco se crea si no se usa).
+  // Los motores con Simulate const se comparten entre hilos; lazy-dfa (que
+  // modifica su caché) tiene una instancia por hilo
+  std::unique_ptr<p06::AutomatonSimulator> nfa_simulator;
+  std::unique_ptr<p06::ShiftAndSimulator> shift_and_simulator;
+  std::unique_ptr<p06::BitsetSimulator> bitset_simulator;
+  std::vector<std::unique_ptr<p06::LazyDfaSimulator>> lazy_dfa_simulators;
+  std::unique_ptr<p06::DfaJit> dfa_jit;
+  std::vector<SimulateFn> simulate(num_threads);
+  // Contadores por hilo, combinados al final
+  std::vector<p06::SimulatorStats> thread_stats(num_threads);
+  if (engine == "nfa") {
+    nfa_simulator = std::make_unique<p06::AutomatonSimulator>(automaton);
+    p06::AutomatonSimulator* engine_ptr = nfa_simulator.get();
+    for (std::size_t t = 0; t < num_threads; ++t) {
+      p06::SimulatorStats* counters = &thread_stats[t];
+      if (stats) {
+        simulate[t] = [engine_ptr, counters](std::string_view input) {
+          return engine_ptr->Simulate(input, *counters);
+        };
+      } else {
+        simulate[t] = [engine_ptr](std::string_view input) {
+          return engine_ptr->Simulate(input);
+        };
+      }
+    }
+  } else if (engine == "dfa") {
+    simulate.assign(num_threads,
+                    [&dfa](std::string_view input) { return dfa.Simulate(input); });
+  } else if (engine == "jit") {
+    dfa_jit = std::make_unique<p06::DfaJit>(dfa);
+    if (dfa_jit->IsCompiled()) {
+      std::cerr << "JIT: " << dfa_jit->GetCodeSize() << " bytes de código x86-64\n";
+    } else {
+      std::cerr << "JIT no disponible (" << dfa_jit->GetFallbackReason()
+                << "): se usa el motor dfa\n";
+    }
+    p06::DfaJit* engine_ptr = dfa_jit.get();
+    simulate.assign(num_threads, [engine_ptr](std::string_view input) {
+      return engine_ptr->Simulate(input);
+    });
+  } else if (engine == "shift-and") {
+    if (!p06::ShiftAndSimulator::Supports(automaton)) {
+      std::cerr << "El motor shift-and admite como mucho "
+                << p06::ShiftAndSimulator::kMaxStates << " estados.\n";
+      return 1;
+    }
+    shift_and_simulator = std::make_unique<p06::ShiftAndSimulator>(automaton);
+    p06::ShiftAndSimulator* engine_ptr = shift_and_simulator.get();
+    simulate.assign(num_threads, [engine_ptr](std::string_view input) {
+      return engine_ptr->Simulate(input);
+    });
+  } else if (engine == "bitset") {
+    if (!p06::BitsetSimulator::Supports(automaton)) {
+      std::cerr << "El motor bitset admite como mucho "
+                << p06::BitsetSimulator::kMaxStates << " estados.\n";
+      return 1;
+    }
+    bitset_simulator = std::make_unique<p06::BitsetSimulator>(automaton);
+    p06::BitsetSimulator* engine_ptr = bitset_simulator.get();
+    simulate.assign(num_threads, [engine_ptr](std::string_view input) {
+      return engine_ptr->Simulate(input);
+    });
+  } else if (engine == "lazy-dfa") {
+    for (std::size_t t = 0; t < num_threads; ++t) {
+      lazy_dfa_simulators.push_back(
+          std::make_unique<p06::LazyDfaSimulator>(automaton, cache_mb << 20));
+      p06::LazyDfaSimulator* engine_ptr = lazy_dfa_simulators.back().get();
+      simulate[t] = [engine_ptr](std::string_view input) {
+        return engine_ptr->Simulate(input);
+      };
+    }
+  }
+
+  // Proyectamos el fichero de cadenas (input.txt) en memoria
+  p06::MappedFile strings_file;
+  if (!strings_file.Open(txt_file, err)) {
     std::cerr << "No se puede abrir fichero de cadenas: " << txt_file << "\n";
     return 3;
   }
+  std::string_view data = strings_file.GetData();
 
-  // Leemos línea a línea, parseamos y simulamos cada cadena
-  std::string line;
-  while (std::getline(ifs, line)) {
-    // original guarda la línea tal cual para imprimirla idéntica
-    std::string original, input;
+  // Combina los contadores de los hilos y los escribe en stderr
+  auto dump_stats = [&]() {
+    if (!stats) return;
+    p06::SimulatorStats total;
+    for (const p06::SimulatorStats& counters : thread_stats) total.Merge(counters);
+    std::cout.flush();
+    std::cerr << "{\"engine\": \"nfa\", \"threads\": " << num_threads << ", \"stats\": ";
+    total.WriteJson(std::cerr);
+    std::cerr << "}\n";
+  };
+
+  if (num_threads > 1) {
+    RunParallel(data, simulate, std::cout);
+    dump_stats();
+    return 0;
+  }
+
+  // Recorremos las líneas sobre la proyección, sin copias por línea. La
+  // salida se acumula en un buffer que se vuelca cada kOutputBytes bytes
+  constexpr std::size_t kOutputBytes = 64 << 10;
+  std::string out;
+  out.reserve(2 * kOutputBytes);
+  ForEachLine(data, [&](std::string_view line) {
+    // original es la línea tal cual (trimmed) para imprimirla idéntica
+    std::string_view original, input;
     ParseInputLine(line, original, input);
-    // Simulamos la cadena
-    bool accepted = simulator.Simulate(input);
+    // Simulamos la cadena con el motor elegido
+    bool accepted = simulate[0](input);
     // Salida es "<línea original> --- Accepted/Rejected"
-    std::cout << original << " --- " << (accepted ? "Accepted" : "Rejected") << "\n";
-  }
+    out.append(original.data(), original.size());
+    out += accepted ? " --- Accepted\n" : " --- Rejected\n";
+    if (out.size() >= kOutputBytes) {
+      std::cout << out;
+      out.clear();
+    }
+  });
+  std::cout << out;
+  dump_stats();
 
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: mapped_file.cc: implementación de la clase MappedFile.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    mmap(2), madvise(2): Linux man-pages
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file mapped_file.cc
+ * @brief Implementación del fichero proyectado en memoria.
+ */
+
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iterator>
+
+namespace p06 {
+
+// Constructor por defecto: sin fichero
+MappedFile::MappedFile() : mapping_(nullptr), size_(0) {}
+
+MappedFile::~MappedFile() {
+  Close();
+}
+
+/**
+ * @brief Libera la proyección o el buffer.
+ */
+void MappedFile::Close() {
+  if (mapping_ != nullptr) munmap(mapping_, size_);
+  mapping_ = nullptr;
+  size_ = 0;
+  std::string().swap(buffer_);
+}
+
+/**
+ * @brief Proyecta el fichero; si no es posible, lo lee a memoria.
+ */
+bool MappedFile::Open(const std::string& filename, std::string& err_msg) {
+  Close();
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    err_msg = "No se puede abrir fichero: " + filename;
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+    if (info.st_size == 0) {
+      // Fichero vacío: mmap no admite longitud 0
+      close(fd);
+      return true;
+    }
+    void* mapping = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ,
+                         MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED) {
+      // Lectura secuencial: el núcleo puede adelantar páginas
+      madvise(mapping, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+      mapping_ = mapping;
+      size_ = static_cast<std::size_t>(info.st_size);
+      close(fd);
+      return true;
+    }
+  }
+  close(fd);
+
+  // No proyectable (tubería, dispositivo...): lectura completa
+  std::ifstream ifs(filename, std::ios::binary);
+  if (!ifs) {
+    err_msg = "No se puede abrir fichero: " + filename;
+    return false;
+  }
+  buffer_.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  return true;
+}
+
+/**
+ * @brief Devuelve el contenido del fichero.
+ */
+std::string_view MappedFile::GetData() const {
+  if (mapping_ != nullptr) return std::string_view(static_cast<const char*>(mapping_), size_);
+  return std::string_view(buffer_);
+}
+
+}
@@ -0,0 +1,76 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: mapped_file.h: interfaz de la clase MappedFile.
+ *    Contiene el acceso de solo lectura a un fichero proyectado en memoria.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    mmap(2), madvise(2): Linux man-pages
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file mapped_file.h
+ * @brief Interfaz del fichero proyectado en memoria.
+ *
+ * Permite recorrer ficheros de varios gigas sin copiarlos: el contenido se
+ * expone como un std::string_view sobre la proyección.
+ */
+
+#ifndef P06_UTIL_MAPPED_FILE_H_
+#define P06_UTIL_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace p06 {
+
+/**
+ * @brief Fichero de solo lectura proyectado en memoria (mmap).
+ *
+ * Si el fichero no se puede proyectar (por ejemplo, una tubería), se lee
+ * entero a memoria y se expone igual, de modo que el llamante no distingue
+ * los dos casos.
+ */
+class MappedFile {
+ public:
+  MappedFile();
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @brief Abre y proyecta el fichero.
+   * @param filename Ruta del fichero
+   * @param err_msg En caso de error se escribe aquí una descripción
+   * @return true en caso de éxito
+   */
+  bool Open(const std::string& filename, std::string& err_msg);
+
+  /**
+   * @brief Contenido completo del fichero (vacío si no hay fichero abierto).
+   */
+  std::string_view GetData() const;
+
+ private:
+  void Close(); // Libera la proyección o el buffer
+
+  void* mapping_; // Dirección de la proyección (nullptr si no hay)
+  std::size_t size_; // Tamaño de la proyección
+  std::string buffer_; // Contenido leído cuando no se puede proyectar
+};
+
+}
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: shift_and_simulator.cc: implementación de la clase ShiftAndSimulator.
+ *    Contiene la precomputación de máscaras y la simulación bit-paralela.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    G. Navarro, M. Raffinot, "Flexible Pattern Matching in Strings", 2002
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file shift_and_simulator.cc
+ * @brief Implementación del simulador Shift-And.
+ */
+
+#include "shift_and_simulator.h"
+
+#include <vector>
+
+#include "epsilon_closure.h"
+
+namespace p06 {
+
+/**
+ * @brief Comprueba si el autómata es apto para el simulador Shift-And.
+ */
+bool ShiftAndSimulator::Supports(const Automaton& automaton) {
+  return automaton.IsFrozen() && automaton.GetNumStates() <= kMaxStates;
+}
+
+/**
+ * @brief Constructor: separa las transiciones de cada clase en desplazamiento
+ * y excepciones y construye las tablas de bytes.
+ *
+ * Pasos:
+ *  -Cierre por & de cada estado como máscara.
+ *  -Para cada clase: q -> q+1 va a shift si el cierre de q+1 es solo q+1;
+ *   el resto de destinos (cerrados) se acumula en la máscara del origen.
+ *  -Una tabla de 256 entradas por cada byte con orígenes de excepción:
+ *   tabla[v] = OR de las máscaras de los estados cuyos bits están en v.
+ */
+ShiftAndSimulator::ShiftAndSimulator(const Automaton& automaton)
+    : class_of_(automaton.GetClassTable()), start_(0), accepting_(0) {
+  const int num_states = automaton.GetNumStates();
+  const int num_classes = automaton.GetNumClasses();
+
+  // Cierre por & de cada estado (con presupuesto n^2 la tabla queda completa)
+  EpsilonClosureTable closure_table(
+      automaton, static_cast<std::size_t>(num_states) * num_states);
+  std::vector<Word> closure(num_states, 0);
+  for (int q = 0; q < num_states; ++q) {
+    for (auto s : closure_table.GetClosure(q)) closure[q] |= Word{1} << s;
+  }
+
+  std::vector<Word> rest(num_states); // Sucesores de excepción de cada estado
+  steps_.resize(num_classes);
+  for (int c = 0; c < num_classes; ++c) {
+    ClassStep& step = steps_[c];
+    step.shift = 0;
+    step.exception = 0;
+    for (int q = 0; q < num_states; ++q) {
+      rest[q] = 0;
+      for (auto dest : automaton.GetTargets(q, c)) {
+        if (dest == q + 1 && closure_table.IsTrivial(dest)) {
+          step.shift |= Word{1} << q;
+        } else {
+          rest[q] |= closure[dest];
+        }
+      }
+      if (rest[q] != 0) step.exception |= Word{1} << q;
+    }
+
+    // Tablas de bytes solo para los bytes con estados de excepción
+    step.first_table = static_cast<int>(table_shift_.size());
+    for (int byte = 0; byte < 8; ++byte) {
+      if (((step.exception >> (8 * byte)) & 0xFF) == 0) continue;
+      std::size_t base = tables_.size();
+      tables_.resize(base + 256, 0);
+      table_shift_.push_back(8 * byte);
+      for (int v = 1; v < 256; ++v) {
+        // v sin su bit más bajo ya está calculado
+        int low = __builtin_ctz(static_cast<unsigned>(v));
+        int q = 8 * byte + low;
+        Word mask = q < num_states ? rest[q] : 0;
+        tables_[base + v] = tables_[base + (v & (v - 1))] | mask;
+      }
+    }
+    step.last_table = static_cast<int>(table_shift_.size());
+  }
+
+  // Estado inicial cerrado y máscara de aceptación
+  if (num_states > 0) start_ = closure[automaton.GetStartState()];
+  for (int q = 0; q < num_states; ++q) {
+    if (automaton.IsAcceptingState(q)) accepting_ |= Word{1} << q;
+  }
+}
+
+/**
+ * @brief Simula la cadena con operaciones sobre una palabra de 64 bits.
+ *
+ * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+ * @return true si la cadena es aceptada, false si es rechazada
+ */
+bool ShiftAndSimulator::Simulate(std::string_view input) const {
+  Word active = start_;
+  for (char c : input) {
+    int class_id = class_of_[static_cast<unsigned char>(c)];
+    if (class_id == Automaton::kNoClass) return false;  // fuera del alfabeto
+    const ClassStep& step = steps_[class_id];
+    Word next = (active & step.shift) << 1;
+    Word exception = active & step.exception;
+    if (exception != 0) {
+      for (int t = step.first_table; t < step.last_table; ++t) {
+        next |= tables_[static_cast<std::size_t>(t) * 256 +
+                        ((exception >> table_shift_[t]) & 0xFF)];
+      }
+    }
+    active = next;
+    if (active == 0) return false;  // no quedan estados activos
+  }
+  return (active & accepting_) != 0;
+}
+
+}
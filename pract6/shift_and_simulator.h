@@ -0,0 +1,102 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: shift_and_simulator.h: interfaz de la clase ShiftAndSimulator.
+ *    Contiene la definición de un simulador bit-paralelo (Shift-And) para
+ *    NFAs de hasta 64 estados.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    G. Navarro, M. Raffinot, "Flexible Pattern Matching in Strings", 2002
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Simulate recibe std::string_view (sin copias de la cadena)
+*/
+
+/**
+ * @file shift_and_simulator.h
+ * @brief Interfaz del simulador Shift-And.
+ *
+ * El conjunto de estados activos cabe en un único uint64_t. Las transiciones
+ * i -> i+1 (las de un autómata "en cadena") se aplican todas a la vez con un
+ * desplazamiento y un AND; el resto se resuelve con tablas indexadas por
+ * bytes del conjunto activo.
+ */
+
+#ifndef P06_SIMULATOR_SHIFT_AND_SIMULATOR_H_
+#define P06_SIMULATOR_SHIFT_AND_SIMULATOR_H_
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "automata.h"
+
+namespace p06 {
+
+/**
+ * @brief Simulador bit-paralelo para NFAs de como mucho 64 estados.
+ *
+ * Para cada clase de símbolo c guarda:
+ *  - shift: estados q con transición q -c-> q+1 cuyo destino tiene cierre
+ *    trivial; su contribución es (activos & shift) << 1.
+ *  - exception: estados con alguna otra transición por c. Su contribución
+ *    (ya cerrada por &) se lee de tablas de 256 entradas, una por cada byte
+ *    del conjunto en el que haya estados de exception.
+ *
+ * Un paso sin excepciones cuesta un AND y un desplazamiento. Da el mismo
+ * resultado que AutomatonSimulator::Simulate.
+ */
+class ShiftAndSimulator {
+ public:
+  // Número máximo de estados admitido (una palabra de 64 bits)
+  static constexpr int kMaxStates = 64;
+
+  /**
+   * @brief Comprueba si el autómata es apto para este simulador.
+   * @return true si está congelado y tiene como mucho kMaxStates estados
+   */
+  static bool Supports(const Automaton& automaton);
+
+  /**
+   * @brief Construye las máscaras y tablas a partir del autómata.
+   * @param automaton Autómata congelado con Supports(automaton) == true
+   */
+  explicit ShiftAndSimulator(const Automaton& automaton);
+
+  /**
+   * @brief Simula la cadena dada sobre el autómata.
+   * @param input Cadena de entrada (string vacío representa la cadena epsilon)
+   * @return true si la cadena es aceptada, false si es rechazada
+   */
+  bool Simulate(std::string_view input) const;
+
+ private:
+  using Word = std::uint64_t;
+
+  // Máscaras de una clase de símbolo
+  struct ClassStep {
+    Word shift; // Orígenes de transiciones q -> q+1 resueltas con desplazamiento
+    Word exception; // Orígenes del resto de transiciones
+    int first_table; // Primera tabla de bytes de la clase en tables_
+    int last_table; // Fin (exclusivo) de las tablas de la clase
+  };
+
+  Automaton::ClassTable class_of_; // Copia de la tabla carácter -> clase
+  std::vector<ClassStep> steps_; // Máscaras de cada clase
+  std::vector<Word> tables_; // Tablas de 256 entradas (sucesores ya cerrados)
+  std::vector<int> table_shift_; // Desplazamiento del byte de cada tabla
+  Word start_; // Cierre por & del estado inicial
+  Word accepting_; // Máscara de estados de aceptación
+};
+
+}
+
+#endif
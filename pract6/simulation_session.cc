@@ -0,0 +1,96 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: simulation_session.cc: implementación de la clase SimulationSession.
+ *    Contiene el avance del conjunto de estados activos trozo a trozo.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Conjuntos en SimulatorScratch
+ *    16/10/2026 - Paso con EpsilonClosureTable::Step
+*/
+
+/**
+ * @file simulation_session.cc
+ * @brief Implementación de la sesión de simulación incremental.
+ */
+
+#include "simulation_session.h"
+
+#include <algorithm>
+
+namespace p06 {
+
+/**
+ * @brief Constructor: reserva la memoria de trabajo y coloca la sesión en su inicio.
+ */
+SimulationSession::SimulationSession(const AutomatonSimulator& simulator)
+    : automaton_(simulator.GetAutomaton()),
+      closure_table_(simulator.GetClosureTable()),
+      consumed_(0) {
+  scratch_.Prepare(automaton_.GetNumStates());
+  Reset();
+}
+
+/**
+ * @brief Vuelve al cierre por & del estado inicial.
+ */
+void SimulationSession::Reset() {
+  scratch_.BeginSet();
+  closure_table_.AppendClosure(automaton_.GetStartState(), scratch_);
+  scratch_.current.swap(scratch_.next);
+  consumed_ = 0;
+}
+
+/**
+ * @brief Avanza el conjunto activo con cada símbolo del trozo.
+ *
+ * Mismo paso que AutomatonSimulator::Simulate (EpsilonClosureTable::Step):
+ * el siguiente conjunto es la unión de los cierres de los destinos.
+ */
+void SimulationSession::Feed(const char* data, std::size_t size) {
+  const Automaton::ClassTable& class_of = automaton_.GetClassTable();
+  for (std::size_t i = 0; i < size && !scratch_.current.empty(); ++i) {
+    ++consumed_;
+    int class_id = class_of[static_cast<unsigned char>(data[i])];
+    if (class_id == Automaton::kNoClass) {
+      scratch_.current.clear();  // fuera del alfabeto
+      return;
+    }
+    closure_table_.Step(scratch_.current, class_id, scratch_);
+    scratch_.current.swap(scratch_.next);
+  }
+}
+
+/**
+ * @brief Comprueba si algún estado activo es de aceptación.
+ */
+bool SimulationSession::IsAccepting() const {
+  return std::any_of(scratch_.current.begin(), scratch_.current.end(),
+                     [this](Automaton::State s) { return automaton_.IsAcceptingState(s); });
+}
+
+/**
+ * @brief Comprueba si el conjunto activo está vacío.
+ */
+bool SimulationSession::IsDead() const {
+  return scratch_.current.empty();
+}
+
+/**
+ * @brief Devuelve los símbolos consumidos desde el último Reset().
+ */
+std::uint64_t SimulationSession::GetConsumed() const {
+  return consumed_;
+}
+
+}
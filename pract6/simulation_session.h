@@ -0,0 +1,105 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: simulation_session.h: interfaz de la clase SimulationSession.
+ *    Contiene una simulación incremental que recibe la cadena por trozos.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - Conjuntos en SimulatorScratch
+*/
+
+/**
+ * @file simulation_session.h
+ * @brief Interfaz de la sesión de simulación incremental.
+ *
+ * AutomatonSimulator::Simulate necesita la cadena completa. Una sesión guarda
+ * el conjunto de estados activos entre llamadas, de modo que una cadena de
+ * tamaño arbitrario (una tubería, un socket) se puede simular por trozos con
+ * memoria constante.
+ */
+
+#ifndef P06_SIMULATOR_SIMULATION_SESSION_H_
+#define P06_SIMULATOR_SIMULATION_SESSION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "automata.h"
+#include "automata_simulator.h"
+#include "simulator_scratch.h"
+
+namespace p06 {
+
+/**
+ * @brief Simulación reanudable de una única cadena.
+ *
+ * Uso: Reset(), varias llamadas a Feed() con trozos consecutivos de la
+ * cadena e IsAccepting() al final. Alimentar los trozos uno a uno da el mismo
+ * veredicto que Simulate con su concatenación.
+ *
+ * El conjunto activo se guarda como lista de estados con marcas por
+ * generación, así que Feed no reserva memoria tras el primer uso. Cuando el
+ * conjunto queda vacío (IsDead) la cadena ya está rechazada y el resto de la
+ * entrada se puede descartar sin leerla.
+ */
+class SimulationSession {
+ public:
+  /**
+   * @brief Crea una sesión sobre el simulador dado y la deja en su inicio.
+   * @param simulator Simulador (y autómata) que deben sobrevivir a la sesión
+   */
+  explicit SimulationSession(const AutomatonSimulator& simulator);
+
+  /**
+   * @brief Vuelve al inicio: conjunto activo = cierre del estado inicial.
+   */
+  void Reset();
+
+  /**
+   * @brief Consume los siguientes size símbolos de la cadena.
+   *
+   * Un símbolo fuera del alfabeto deja la sesión muerta, igual que en Simulate.
+   *
+   * @param data Trozo de la cadena
+   * @param size Número de símbolos del trozo
+   */
+  void Feed(const char* data, std::size_t size);
+
+  /**
+   * @brief true si la cadena consumida hasta ahora es aceptada.
+   */
+  bool IsAccepting() const;
+
+  /**
+   * @brief true si no queda ningún estado activo (rechazo definitivo).
+   */
+  bool IsDead() const;
+
+  /**
+   * @brief Número de símbolos consumidos desde el último Reset().
+   *
+   * Si la sesión murió, cuenta hasta el símbolo que la dejó sin estados.
+   */
+  std::uint64_t GetConsumed() const;
+
+ private:
+  const Automaton& automaton_; // Autómata simulado
+  const EpsilonClosureTable& closure_table_; // Cierres del simulador
+  SimulatorScratch scratch_; // Conjunto activo (current) y en construcción (next)
+  std::uint64_t consumed_; // Símbolos consumidos
+};
+
+}
+
+#endif
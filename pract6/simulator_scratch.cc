@@ -0,0 +1,56 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: simulator_scratch.cc: implementación de SimulatorScratch.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - BeginSet en línea
+*/
+
+/**
+ * @file simulator_scratch.cc
+ * @brief Implementación de la memoria de trabajo del simulador.
+ */
+
+#include "simulator_scratch.h"
+
+#include <algorithm>
+
+namespace p06 {
+
+/**
+ * @brief Garantiza capacidad para num_states estados.
+ *
+ * Las marcas nuevas valen 0, que nunca es una generación en uso.
+ */
+void SimulatorScratch::Prepare(int num_states) {
+  auto n = static_cast<std::size_t>(num_states);
+  if (marks.size() >= n) return;
+  marks.resize(n, 0);
+  current.reserve(n);
+  next.reserve(n);
+  worklist.reserve(n);
+}
+
+/**
+ * @brief Vuelta del contador de generaciones (una vez cada 2^32 conjuntos).
+ *
+ * Se borran las marcas para que ninguna marca antigua coincida con la
+ * generación.
+ */
+void SimulatorScratch::ResetMarks() {
+  std::fill(marks.begin(), marks.end(), 0);
+  generation = 1;
+}
+
+}
@@ -0,0 +1,92 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: simulator_scratch.h: memoria de trabajo de AutomatonSimulator.
+ *    Contiene los conjuntos activos, las marcas por generación y la pila del
+ *    cierre, reutilizables entre llamadas a Simulate.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ *    P. Briggs, L. Torczon, "An Efficient Representation for Sparse Sets", 1993
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+ *    16/10/2026 - BeginSet en línea; la inserción pasa a AppendClosure
+*/
+
+/**
+ * @file simulator_scratch.h
+ * @brief Memoria de trabajo reutilizable de la simulación del NFA.
+ *
+ * Cada conjunto de estados es un conjunto disperso: una lista densa de
+ * estados (iteración en orden de inserción) y un vector indexado por estado
+ * para la pertenencia. En lugar del índice en la lista de Briggs y Torczon,
+ * el vector guarda una marca de generación: un estado pertenece al conjunto
+ * en construcción si su marca es la generación actual, así que vaciarlo es
+ * incrementar la generación (O(1)), sin recorrer el vector.
+ */
+
+#ifndef P06_SIMULATOR_SIMULATOR_SCRATCH_H_
+#define P06_SIMULATOR_SIMULATOR_SCRATCH_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "automata.h"
+
+namespace p06 {
+
+/**
+ * @brief Conjuntos activos y pila de trabajo de AutomatonSimulator::Simulate.
+ *
+ * Tras Prepare(n) todos los vectores tienen capacidad para n estados, que es
+ * el máximo que pueden contener, así que la simulación no reserva memoria.
+ * Una instancia puede pasar de un autómata a otro (Prepare solo crece) pero
+ * no debe usarse desde dos hilos a la vez: Simulate(input) usa una por hilo.
+ */
+struct SimulatorScratch {
+  std::vector<Automaton::State> current; // Conjunto activo (ya cerrado)
+  std::vector<Automaton::State> next; // Conjunto en construcción
+  std::vector<Automaton::State> worklist; // Pila del cierre sin tabla
+  std::vector<std::uint32_t> marks; // Marca de pertenencia a next
+  std::uint32_t generation = 0; // Valor de marca de next
+
+  /**
+   * @brief Garantiza capacidad para num_states estados (solo reserva si crece).
+   */
+  void Prepare(int num_states);
+
+  /**
+   * @brief Abre un conjunto vacío en next (nueva generación).
+   *
+   * Se llama una vez por símbolo, así que va en línea; solo la vuelta del
+   * contador (ResetMarks) queda fuera.
+   */
+  void BeginSet() {
+    if (++generation == 0) ResetMarks();
+    next.clear();
+  }
+
+  /**
+   * @brief Borra las marcas y reinicia la generación a 1.
+   */
+  void ResetMarks();
+
+  /**
+   * @brief true si state ya está en next.
+   *
+   * Los estados se añaden con EpsilonClosureTable::AppendClosure, que marca
+   * cada uno con la generación actual.
+   */
+  bool Contains(Automaton::State state) const { return marks[state] == generation; }
+};
+
+}
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: simulator_stats.cc: implementación de la estructura SimulatorStats.
+ *    Contiene la combinación de contadores y su escritura en JSON.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file simulator_stats.cc
+ * @brief Implementación de SimulatorStats.
+ */
+
+#include "simulator_stats.h"
+
+#include <algorithm>
+
+namespace p06 {
+
+/**
+ * @brief Acumula los contadores de otro hilo.
+ */
+void SimulatorStats::Merge(const SimulatorStats& other) {
+  strings += other.strings;
+  accepted += other.accepted;
+  symbols += other.symbols;
+  states_expanded += other.states_expanded;
+  closure_calls += other.closure_calls;
+  closure_iterations += other.closure_iterations;
+  epsilon_edges += other.epsilon_edges;
+  peak_active = std::max(peak_active, other.peak_active);
+  early_rejections += other.early_rejections;
+}
+
+/**
+ * @brief Escribe los contadores y la media de estados expandidos por símbolo.
+ */
+void SimulatorStats::WriteJson(std::ostream& os) const {
+  double per_symbol =
+      symbols > 0 ? static_cast<double>(states_expanded) / static_cast<double>(symbols) : 0.0;
+  os << "{\"strings\": " << strings << ", \"accepted\": " << accepted
+     << ", \"symbols\": " << symbols << ", \"states_expanded\": " << states_expanded
+     << ", \"states_expanded_per_symbol\": " << per_symbol
+     << ", \"closure_calls\": " << closure_calls
+     << ", \"closure_iterations\": " << closure_iterations
+     << ", \"epsilon_edges\": " << epsilon_edges << ", \"peak_active\": " << peak_active
+     << ", \"early_rejections\": " << early_rejections << "}";
+}
+
+}
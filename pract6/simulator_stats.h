@@ -0,0 +1,64 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: simulator_stats.h: interfaz de la estructura SimulatorStats.
+ *    Contiene los contadores del bucle de simulación de AutomatonSimulator.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file simulator_stats.h
+ * @brief Contadores de la simulación (opción --stats).
+ */
+
+#ifndef P06_SIMULATOR_SIMULATOR_STATS_H_
+#define P06_SIMULATOR_SIMULATOR_STATS_H_
+
+#include <cstdint>
+#include <ostream>
+
+namespace p06 {
+
+/**
+ * @brief Contadores de AutomatonSimulator::Simulate(input, stats).
+ *
+ * Cada hilo usa su propia instancia (sin atómicos; alineada a una línea de
+ * caché para que las de hilos distintos no la compartan) y al final se
+ * combinan con Merge.
+ */
+struct alignas(64) SimulatorStats {
+  std::uint64_t strings = 0; // Cadenas simuladas
+  std::uint64_t accepted = 0; // Cadenas aceptadas
+  std::uint64_t symbols = 0; // Símbolos consumidos
+  std::uint64_t states_expanded = 0; // Estados activos expandidos (suma por paso)
+  std::uint64_t closure_calls = 0; // Cierres por & de un estado
+  std::uint64_t closure_iterations = 0; // Estados recorridos por esos cierres
+  std::uint64_t epsilon_edges = 0; // Transiciones & seguidas (cierres sin tabla)
+  std::uint64_t peak_active = 0; // Máximo de estados activos en un paso
+  std::uint64_t early_rejections = 0; // Rechazos antes de consumir toda la cadena
+
+  /**
+   * @brief Acumula other en este objeto (sumas y, para el pico, máximo).
+   */
+  void Merge(const SimulatorStats& other);
+
+  /**
+   * @brief Escribe los contadores como un objeto JSON.
+   */
+  void WriteJson(std::ostream& os) const;
+};
+
+}
+
+#endif
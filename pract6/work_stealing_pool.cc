@@ -0,0 +1,122 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: work_stealing_pool.cc: implementación de la clase WorkStealingPool.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file work_stealing_pool.cc
+ * @brief Implementación del pool de hilos con robo de tareas.
+ */
+
+#include "work_stealing_pool.h"
+
+#include <utility>
+
+namespace p06 {
+
+/**
+ * @brief Constructor: crea las colas y arranca los hilos.
+ */
+WorkStealingPool::WorkStealingPool(int num_threads)
+    : next_queue_(0), pending_(0), stop_(false) {
+  if (num_threads < 1) num_threads = 1;
+  for (int i = 0; i < num_threads; ++i) queues_.push_back(std::make_unique<Queue>());
+  for (int i = 0; i < num_threads; ++i) {
+    threads_.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+  }
+}
+
+/**
+ * @brief Destructor: los hilos terminan cuando no quedan tareas.
+ */
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) thread.join();
+}
+
+/**
+ * @brief Encola la tarea y despierta a un hilo ocioso.
+ *
+ * pending_ se incrementa antes de encolar (un hilo no puede sacar la tarea
+ * antes de contarla) y con wake_mutex_ tomado, para que ningún hilo se
+ * duerma justo después de ver la cola vacía (aviso perdido).
+ */
+void WorkStealingPool::Submit(Task task) {
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    ++pending_;
+  }
+  std::size_t index = next_queue_.fetch_add(1) % queues_.size();
+  {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+  wake_.notify_one();
+}
+
+/**
+ * @brief Devuelve el número de hilos del pool.
+ */
+int WorkStealingPool::GetNumThreads() const {
+  return static_cast<int>(threads_.size());
+}
+
+/**
+ * @brief Saca una tarea de la cola propia o la roba de otra.
+ */
+bool WorkStealingPool::TryPop(int worker, Task& task) {
+  const std::size_t num_queues = queues_.size();
+  for (std::size_t k = 0; k < num_queues; ++k) {
+    Queue& queue = *queues_[(worker + k) % num_queues];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) continue;
+    if (k == 0) {
+      // Cola propia: por el frente (orden de envío)
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    } else {
+      // Robo: por el final, lejos de lo que está haciendo el dueño
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    }
+    --pending_;
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Bucle de cada hilo: ejecuta tareas y duerme si no hay ninguna.
+ */
+void WorkStealingPool::WorkerLoop(int worker) {
+  Task task;
+  while (true) {
+    if (TryPop(worker, task)) {
+      task(worker);
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    wake_.wait(lock, [this] { return stop_ || pending_ > 0; });
+    if (stop_ && pending_ == 0) return;
+  }
+}
+
+}
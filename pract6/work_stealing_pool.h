@@ -0,0 +1,97 @@
+/**
+ * Universidad de La Laguna
+ * Escuela Superior de Ingeniería y Tecnología
+ * Grado en Ingeniería Informática
+ * Asignatura: Computabilidad y Algoritmia
+ * Curso: 2º
+ * Práctica 6: Diseño e implementación de un simulador de autómatas finitos.
+ * Autor: Daniel Palenzuela Álvarez
+ * Correo: alu0101140469@ull.edu.es
+ * Fecha: 16/10/2026
+ * Archivo: work_stealing_pool.h: interfaz de la clase WorkStealingPool.
+ *    Contiene un pool de hilos con una cola por hilo y robo de tareas.
+ * Referencias:
+ *    Transparencias del Tema 2 de la asignatura: Autómatas finitos y lenguajes regulares
+ *    https://campusvirtual.ull.es/2526/ingenieriaytecnologia/mod/resource/view.php?id=11856
+ * Historial de revisiones
+ *    16/10/2026 - Creación (primera versión) del código
+*/
+
+/**
+ * @file work_stealing_pool.h
+ * @brief Interfaz del pool de hilos con robo de tareas.
+ *
+ * Cada hilo atiende primero su propia cola (por el frente) y, cuando se
+ * queda sin trabajo, roba tareas del final de las colas de los demás. Así
+ * los bloques de cadenas caras no dejan hilos ociosos.
+ */
+
+#ifndef P06_UTIL_WORK_STEALING_POOL_H_
+#define P06_UTIL_WORK_STEALING_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace p06 {
+
+/**
+ * @brief Pool de hilos de tamaño fijo con robo de tareas.
+ *
+ * Las tareas reciben el índice del hilo que las ejecuta (0 .. N-1), de modo
+ * que pueden usar recursos propios de cada hilo sin sincronización. El
+ * destructor espera a que terminen todas las tareas enviadas.
+ */
+class WorkStealingPool {
+ public:
+  using Task = std::function<void(int worker)>;
+
+  /**
+   * @brief Arranca num_threads hilos (al menos uno).
+   */
+  explicit WorkStealingPool(int num_threads);
+
+  /**
+   * @brief Ejecuta las tareas pendientes y espera a los hilos.
+   */
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  /**
+   * @brief Encola una tarea (reparto circular entre las colas de los hilos).
+   */
+  void Submit(Task task);
+
+  int GetNumThreads() const; // Número de hilos del pool
+
+ private:
+  // Cola de un hilo protegida por su propio mutex
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  // Saca una tarea: de la cola propia por el frente o robada por el final
+  bool TryPop(int worker, Task& task);
+  void WorkerLoop(int worker);
+
+  std::vector<std::unique_ptr<Queue>> queues_; // Una cola por hilo
+  std::vector<std::thread> threads_; // Hilos trabajadores
+  std::atomic<std::size_t> next_queue_; // Cola de la próxima tarea enviada
+  std::atomic<std::size_t> pending_; // Tareas encoladas aún no sacadas
+  std::mutex wake_mutex_; // Protege stop_ y el aviso de tareas nuevas
+  std::condition_variable wake_; // Despierta hilos ociosos
+  bool stop_; // true cuando el destructor pide terminar
+};
+
+}
+
+#endif